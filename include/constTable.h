@@ -0,0 +1,57 @@
+/**
+ * @file constTable.h
+ * @brief Compile-time (constexpr) lookup table generation into PROGMEM
+ * @version 1.0.0
+ * 
+ * Builds a flash table of N entries from a constexpr generator function,
+ * using a C++11 index sequence:
+ * 
+ *     constexpr LedColor gradient(uint16_t i) { ... }
+ *     typedef ConstTable<LedColor, gradient, 101> GradientLut;
+ *     memcpy_P(&c, &GradientLut::data[i], sizeof(c));
+ * 
+ * The initializer is a constant expression, so the table is emitted by
+ * the compiler as data; no generator code or float math reaches the
+ * target, and nothing is copied to SRAM at startup.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+/// @brief Compile-time list of indices 0..N-1 (std::index_sequence for C++11).
+template <uint16_t... I>
+struct IndexSeq {};
+
+template <uint16_t N, uint16_t... I>
+struct MakeIndexSeq : MakeIndexSeq<N - 1, N - 1, I...> {};
+
+template <uint16_t... I>
+struct MakeIndexSeq<0, I...>
+{
+    typedef IndexSeq<I...> type;
+};
+
+template <typename T, T (*Gen)(uint16_t), typename Seq>
+struct ConstTableImpl;
+
+template <typename T, T (*Gen)(uint16_t), uint16_t... I>
+struct ConstTableImpl<T, Gen, IndexSeq<I...> >
+{
+    static const T data[sizeof...(I)];
+};
+
+template <typename T, T (*Gen)(uint16_t), uint16_t... I>
+const T ConstTableImpl<T, Gen, IndexSeq<I...> >::data[sizeof...(I)] PROGMEM = { Gen(I)... };
+
+/**
+ * @brief PROGMEM table data[i] = Gen(i) for i in [0, N).
+ * @tparam T   Literal entry type
+ * @tparam Gen constexpr generator
+ * @tparam N   Entry count
+ */
+template <typename T, T (*Gen)(uint16_t), uint16_t N>
+struct ConstTable : ConstTableImpl<T, Gen, typename MakeIndexSeq<N>::type> {};
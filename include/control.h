@@ -0,0 +1,106 @@
+/**
+ * @file control.h
+ * @brief Control law (distance → speed + timed maneuver) and its timer tick
+ * @version 1.0.0
+ *
+ * Controller runs the distance mapping and the NORMAL / STOPPING /
+ * REVERSING / SLOW_FORWARD maneuver through the table-driven
+ * ManeuverEngine (maneuver.h). It has no I/O: the caller passes the
+ * latest distance and the time, and applies the result.
+ *
+ * Timer tick (CONTROL_TIMER_ISR=1): ControlTick runs Controller and the
+ * motor outputs from a Timer2 CTC interrupt at CONTROL_ISR_HZ, so the
+ * control period no longer depends on what loop() is doing (display
+ * flush, pulseIn()). Handoff with loop() is lock-free:
+ *  - Inputs (distance, supply mV) are published by loop() under a
+ *    sequence counter; the ISR copies them only when the counter is even
+ *    (no write in progress) and otherwise reuses the previous copy.
+ *  - Outputs (speed, mode, applied duty, timing) are published by the
+ *    ISR under a second counter; loop() re-reads until it gets the same
+ *    even value before and after the copy.
+ * The ISR measures its own execution time and its entry latency after
+ * the compare match (Timer2 ticks, 64µs resolution), so the control
+ * latency is bounded and visible.
+ *
+ * Timer2 drives the D3/D11 LED PWM unless LED_USE_BAM=1, so the timer
+ * tick requires LED_USE_BAM=1.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+#include "ledBam.h"
+#include "maneuver.h"
+#include "motor.h"
+
+#ifndef CONTROL_TIMER_ISR
+#define CONTROL_TIMER_ISR 0     ///< 1 = control law runs from the Timer2 CTC interrupt
+#endif
+
+#if CONTROL_TIMER_ISR && !LED_USE_BAM
+#error "CONTROL_TIMER_ISR needs Timer2: build with LED_USE_BAM=1 (frees D3/D11 PWM timer)"
+#endif
+
+class Controller
+{
+public:
+    /**
+     * @brief Run one control step.
+     * @param distance Latest distance in cm (0 = no obstruction)
+     * @param now Current time (ms)
+     * @return Commanded speed -100..100
+     */
+    int step(int distance, unsigned long now);
+
+    ManeuverState mode() const { return maneuver.state(); }
+
+private:
+    ManeuverEngine maneuver{MANEUVER_TABLE, MANEUVER_TABLE_ROWS};
+};
+
+#if CONTROL_TIMER_ISR
+
+/// @brief Control state published by the ISR
+struct ControlOutputs
+{
+    int distance;           ///< Distance the step used
+    int speedPct;           ///< Commanded speed
+    uint8_t mode;           ///< ManeuverState
+    int target;             ///< Motor command after deadband
+    int duty;               ///< Applied bridge duty -255..255
+    bool kick;              ///< Kick-start active
+    uint16_t execUs;        ///< Last ISR execution time
+    uint16_t maxExecUs;     ///< Worst ISR execution time
+    uint16_t maxLatencyUs;  ///< Worst compare-match → ISR entry delay
+    uint16_t ticks;         ///< ISR runs (wraps)
+};
+
+class ControlTick
+{
+public:
+    static const uint8_t CONTROL_ISR_HZ = 100;
+
+    /**
+     * @brief Start the Timer2 CTC interrupt driving controller and motor.
+     * The objects must outlive the interrupt (globals).
+     */
+    static void begin(Controller& controller, Motor& motor);
+
+    /// @brief Publish the latest inputs (loop context)
+    static void setInputs(int distance, uint16_t supplyMv);
+
+    /// @brief Consistent copy of the latest outputs (loop context)
+    static ControlOutputs outputs();
+
+    /// @brief Stop the interrupt; the motor goes back to loop() (safe stop,
+    ///        watchdog ISR)
+    static void halt();
+
+    /// @brief ISR body (called from TIMER2_COMPA_vect)
+    static void isr();
+};
+
+#endif
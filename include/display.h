@@ -10,6 +10,65 @@
  * 
  * Uses I2C communication on Arduino Uno R3 SDA/SCL pins (AD4/AD5)
  * 
+ * Buffer modes (DISPLAY_PAGE_BUFFER, compile time):
+ * 
+ * | Mode | Driver | Frame RAM | Render passes | Frame time (est.)        |
+ * |------|--------|-----------|---------------|--------------------------|
+ * | 0    | `_F_`  | 1024 B    | 1             | ~1ms render + I2C flush  |
+ * | 2    | `_2_`  | 256 B     | 4             | ~4ms render + I2C flush  |
+ * | 1    | `_1_`  | 128 B     | 8             | ~8ms render + I2C flush  |
+ * 
+ * The I2C transfer (1 KB per frame, ~25ms at 400kHz, ~95ms at 100kHz)
+ * is the same in every mode and dominates; page modes trade ~1ms of
+ * re-render per extra pass for 768–896 bytes of SRAM. Estimates are
+ * from glyph counts, not measured on hardware.
+ * 
+ * Async flush (DISPLAY_ASYNC_FLUSH=1, full buffer only): dirty tiles are
+ * streamed from the frame buffer by the TWI interrupt (I2cAsync) and
+ * update() returns right after rendering. While a stream is running,
+ * busy() is true and update() skips the frame, so the display rate
+ * floats with spare bus capacity and the loop never waits on I2C.
+ * A transfer aborted by a NACK or bus error forces a full redraw on the
+ * next update().
+ * Requires -D U8X8_NO_HW_I2C so U8g2 does not link Wire (which owns the
+ * same interrupt vector).
+ * 
+ * Text-only back end (DISPLAY_USE_U8X8=1): U8x8 writes 8x8 tiles
+ * straight to the panel with no frame buffer at all. Only characters that
+ * differ from what is on screen are resent (a changed digit = 8 bytes),
+ * and the status bar is drawn as generated 8x8 bar tiles, resending only
+ * the tiles whose fill changed. Implemented in displayU8x8.cpp.
+ * 
+ * Pages: update() takes the shared Telemetry snapshot and draws only the
+ * fields of the current page (main status, history plot, loop timing,
+ * sensor health, motor state). setPage()/nextPage() only mark the page;
+ * the redraw happens in the next update(), so switching pages never
+ * touches the bus from the caller. Diagnostic pages are four text lines
+ * (displayPages.cpp); only lines whose text changed are redrawn and
+ * flushed.
+ * 
+ * History page (PAGE_GRAPH, frame-buffer back ends): addSample() feeds a
+ * 128-entry ring of packed 8-bit (distance, speed) samples, decimated
+ * from the control rate. The plot sweeps left to right, one column per
+ * sample; each frame draws only the newly exposed column(s) plus an
+ * erase-ahead gap and flushes just those tiles.
+ * 
+ * Static / dynamic layers (main page, full buffer): title, labels and
+ * the bar outline are drawn once per full frame; steady-state frames
+ * clear and redraw only the bounding boxes of changed values.
+ * 
+ * Digit sprites (DISPLAY_SPRITE_DIGITS=1, full buffer): the numeric
+ * fields (digits, %, cm, FWD/REV) are 5x7 sprites stored in PROGMEM in
+ * SSD1306 page format (displaySprites.h) and copied straight into one
+ * buffer page, instead of U8g2 decoding compressed ncenB08 glyphs. The
+ * value fields then also fit one tile row, halving their flush size.
+ * lastRenderUs() reports the drawing time for A/B comparison with
+ * DISPLAY_SPRITE_DIGITS=0.
+ * 
+ * Change detection: update() remembers the last rendered (distance,
+ * pwmPercent, error) and returns without rendering or touching the bus
+ * when nothing visible changed.
+ * 
  * @author Michael Garcia, M&E Design
  * @contact michael@mandedesign.studio
  * @website www.mandedesign.studio
@@ -20,10 +79,64 @@
 #pragma once
 #include <Arduino.h>
 #include <U8g2lib.h>
+#include "telemetry.h"
+
+#ifndef DISPLAY_PAGE_BUFFER
+#define DISPLAY_PAGE_BUFFER 0   ///< 0 = full buffer, 1 / 2 = 1- / 2-page buffer
+#endif
+
+#ifndef DISPLAY_USE_U8X8
+#define DISPLAY_USE_U8X8 0      ///< 1 = frame-buffer-less U8x8 text back end
+#endif
+
+#include "i2cAsync.h"     // DISPLAY_ASYNC_FLUSH
+
+#if DISPLAY_USE_U8X8 && (DISPLAY_PAGE_BUFFER || DISPLAY_ASYNC_FLUSH)
+#error "DISPLAY_USE_U8X8 has no frame buffer: disable DISPLAY_PAGE_BUFFER / DISPLAY_ASYNC_FLUSH"
+#endif
+
+#ifndef DISPLAY_SPRITE_DIGITS
+#define DISPLAY_SPRITE_DIGITS 1 ///< 1 = blit numeric fields from PROGMEM sprites
+#endif
+
+// Sprites are copied straight into the frame buffer: full buffer only
+#define DISPLAY_BLIT_DIGITS (DISPLAY_SPRITE_DIGITS && !DISPLAY_PAGE_BUFFER && !DISPLAY_USE_U8X8)
+
+#if DISPLAY_ASYNC_FLUSH
+#if DISPLAY_PAGE_BUFFER
+#error "DISPLAY_ASYNC_FLUSH needs the full frame buffer (DISPLAY_PAGE_BUFFER=0)"
+#endif
+#ifndef U8X8_NO_HW_I2C
+#error "DISPLAY_ASYNC_FLUSH replaces Wire: also build with -D U8X8_NO_HW_I2C"
+#endif
+#endif
+
+#if DISPLAY_USE_U8X8
+typedef U8X8_SSD1306_128X64_NONAME_HW_I2C DisplayDriver;
+#elif DISPLAY_ASYNC_FLUSH
+typedef U8G2 DisplayDriver;   // set up in Display() with the I2cAsync byte callback
+#elif DISPLAY_PAGE_BUFFER == 1
+typedef U8G2_SSD1306_128X64_NONAME_1_HW_I2C DisplayDriver;
+#elif DISPLAY_PAGE_BUFFER == 2
+typedef U8G2_SSD1306_128X64_NONAME_2_HW_I2C DisplayDriver;
+#else
+typedef U8G2_SSD1306_128X64_NONAME_F_HW_I2C DisplayDriver;
+#endif
 
 class Display
 {
 public:
+    /// @brief Screen pages
+    enum Page : uint8_t
+    {
+        PAGE_MAIN = 0,      ///< Distance, PWM, bar
+        PAGE_GRAPH,         ///< Scrolling distance / speed history
+        PAGE_LOOP,          ///< Control tick timing
+        PAGE_SENSOR,        ///< Ultrasonic health and histogram
+        PAGE_MOTOR,         ///< Maneuver mode, target, applied duty
+        PAGE_COUNT
+    };
+
     /**
      * @brief Constructor
      */
@@ -35,14 +148,250 @@ public:
     void begin();
     
     /**
-     * @brief Update display with current system status
+     * @brief Draw the current page from the telemetry snapshot.
+     * Skips render and flush if the page's fields match the last frame.
+     * @param t Shared telemetry snapshot
+     */
+    void update(const Telemetry& t);
+
+    /**
+     * @brief Select the page shown by update() (redrawn there in full).
+     * U8x8 back end: PAGE_GRAPH is not available and is ignored.
+     */
+    void setPage(Page page);
+
+    /// @brief Cycle to the next available page
+    void nextPage();
+
+    /// @brief Page currently shown
+    Page page() const { return currentPage; }
+
+    /**
+     * @brief Record a control sample for the history plot.
+     * O(1), RAM only: safe to call every control tick; every
+     * HISTORY_DECIMATION-th call is stored.
+     * @param distance Distance in cm (0 = no obstruction)
+     * @param speedPct Commanded speed (-100..100)
+     */
+    void addSample(int distance, int speedPct);
+
+    /// @brief Bytes sent to the panel by the last update() that drew
+    uint16_t lastFlushBytes() const { return flushBytes; }
+
+    /// @brief Duration of the last render + flush (µs, saturates at 65535);
+    ///        async: render + queue only
+    uint16_t lastFlushUs() const { return flushUs; }
+
+    /// @brief Drawing time of the last main-page frame, without flush (µs)
+    uint16_t lastRenderUs() const { return renderUs; }
+
+    /// @brief True while a background flush is still streaming
+    bool busy() const;
+
+private:
+#if DISPLAY_USE_U8X8
+    /// @brief SSD1306 128x64 OLED driver (hardware I2C, U8x8 tile output)
+    DisplayDriver u8x8;
+#else
+    /// @brief SSD1306 128x64 OLED driver (hardware I2C, full or page buffer)
+    DisplayDriver u8g2;
+#endif
+
+    static const uint16_t FRAME_BYTES = 1024;   ///< 128x64 / 8
+
+    // Layout (px) of the dynamic fields, used for dirty-tile tracking
+    static const uint8_t DIST_BASELINE = 30;
+    static const uint8_t PWM_BASELINE  = 46;
+    static const uint8_t DIST_PAGE = 3;        ///< Sprite page: (baseline - 6) / 8
+    static const uint8_t PWM_PAGE  = 5;
+    static const uint8_t TEXT_ASCENT   = 9;    ///< ncenB08 rows above baseline
+    static const uint8_t TEXT_HEIGHT   = 12;   ///< ascent + descent + 1
+    static const uint8_t BAR_X = 2;
+    static const uint8_t BAR_Y = 52;
+    static const uint8_t BAR_H = 6;
+    static const uint8_t BAR_MAX_W = 124;
+
+    uint8_t distWidth = 0;      ///< Right edge (px) of drawn distance line
+    uint8_t pwmWidth = 0;       ///< Right edge (px) of drawn PWM line
+    uint8_t distLabelWidth = 0; ///< "Distance: " label width (static layer)
+    uint8_t pwmLabelWidth = 0;  ///< "PWM: " label width (static layer)
+    uint16_t flushBytes = 0;    ///< Bytes sent by last frame
+    uint16_t flushUs = 0;       ///< Render + flush time of last frame (saturating)
+    uint16_t renderUs = 0;      ///< Render time of last main-page frame
+
+    Page currentPage = PAGE_MAIN;
+
+    bool frameValid = false;    ///< A status frame is on screen
+    int shownDistance = 0;      ///< Distance of the frame on screen
+    int shownPwm = 0;           ///< PWM% of the frame on screen
+    bool shownError = false;    ///< Error flag of the frame on screen
+
+    static const uint8_t DIAG_LINES = 4;    ///< Text lines per diagnostic page
+    static const uint8_t DIAG_COLS = 16;    ///< Max chars per line (U8x8 grid)
+
+    /**
+     * @brief Main page: distance, PWM, bar.
      * @param distance Distance reading in cm (0 = no obstruction / invalid)
      * @param pwmPercent Motor PWM output (-100 to 100, sign = direction)
      * @param error Error state flag (true = sensor/system fault)
      */
-    void update(int distance, int pwmPercent, bool error);
+    void updateMain(int distance, int pwmPercent, bool error);
 
-private:
-    /// @brief SSD1306 128x64 OLED driver (hardware I2C, full buffer)
-    U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2;
+    /// @brief Diagnostic pages: redraw and flush only changed lines
+    void updateDiag(const Telemetry& t);
+
+    static bool pageAvailable(Page page);
+
+    /// @brief µs since startUs, saturated to 16 bits (a full 1KB frame at
+    ///        100kHz I2C plus render can exceed 65.5ms)
+    static uint16_t elapsedUs(unsigned long startUs);
+
+    /// @brief PROGMEM title of a diagnostic page
+    static const char* diagTitle(Page page);
+
+    /**
+     * @brief Build one diagnostic line (at most DIAG_COLS chars).
+     * @param line Destination (24 bytes)
+     * @return Pointer to the terminating NUL
+     */
+    static char* formatDiagLine(char* line, Page page, uint8_t index, const Telemetry& t);
+
+#if DISPLAY_USE_U8X8
+    static const uint8_t COLS = 16;         ///< 8x8 character columns
+    static const uint8_t ROW_TITLE = 0;
+    static const uint8_t ROW_DIST = 3;
+    static const uint8_t ROW_PWM = 5;
+    static const uint8_t ROW_BAR = 7;
+    static const uint8_t ROW_DIAG = 2;      ///< First diagnostic line
+    static const uint8_t TEXT_ROWS = DIAG_LINES;  ///< Cached rows (main page uses 3)
+
+    char shownText[TEXT_ROWS][COLS + 1];    ///< Characters on screen per row
+    uint8_t shownBar = 0;                   ///< Bar length on screen (px)
+    bool barValid = false;                  ///< Bar row holds bar tiles
+
+    /**
+     * @brief Write a row, sending only the characters that changed.
+     * @param row Screen row
+     * @param cache Row cache (COLS chars)
+     * @param text New text, padded with spaces to COLS
+     */
+    void drawRow(uint8_t row, char* cache, const char* text);
+
+    /// @brief Draw the bar row, sending only tiles whose fill changed
+    void drawBar(uint8_t width);
+
+    /// @brief Clear the panel, draw the page title, forget what is on screen
+    void resetScreen();
+#endif
+
+#if !DISPLAY_USE_U8X8
+    static const uint8_t DIAG_BASELINE = 24;    ///< First diagnostic line
+
+    char shownDiag[DIAG_LINES][DIAG_COLS + 1];  ///< Text of each line on screen
+
+    /// @brief Graph/diag title at the top of the frame
+    void drawTitle(const char* progmemStr);
+
+    /// @brief One packed history point (2 bytes)
+    struct HistorySample
+    {
+        uint8_t distance;   ///< cm, 255 = no obstruction / beyond
+        int8_t speed;       ///< -100..100 %
+    };
+
+    static const uint8_t HISTORY_LEN = 128;         ///< One sample per column
+    static const uint8_t HISTORY_DECIMATION = 10;   ///< Ticks per sample (10Hz @ 100Hz)
+    static const uint8_t PLOT_Y = 14;               ///< Plot area top
+    static const uint8_t PLOT_H = 50;               ///< Plot area height
+    static const uint8_t PLOT_MAX_CM = 100;         ///< Distance at plot top
+
+    HistorySample history[HISTORY_LEN];     ///< Ring, index = screen column
+    uint16_t sampleSeq = 0;     ///< Samples stored (wraps; LEN divides 2^16)
+    uint16_t plottedSeq = 0;    ///< Samples drawn on screen
+    bool historyFull = false;   ///< Ring has wrapped at least once
+    uint8_t decimCount = 0;
+
+    /// @brief Graph page: draw new columns and flush them
+    void updateGraph();
+
+    /// @brief Graph page: draw title and all stored columns
+    void renderGraph();
+
+    /**
+     * @brief Draw the column of one sample plus the erase-ahead gap
+     * @param connect Join to the previous column's points
+     */
+    void drawColumn(uint16_t seq, bool connect);
+
+    static uint8_t distY(uint8_t cm);
+    static uint8_t speedY(int8_t pct);
+#endif
+
+    /**
+     * @brief Draw one complete frame (static + dynamic layer).
+     * Full-buffer mode: only for full frames; page-buffer mode: every
+     * frame, once per page.
+     */
+    void render(int distance, int pwmPercent, bool error);
+
+#if !DISPLAY_USE_U8X8
+    /// @brief Dynamic field: distance value (+ label on a full line redraw)
+    void drawDistance(int distance, bool withLabel);
+
+    /// @brief Dynamic field: PWM value and direction after the label
+    void drawPwm(int pwmPercent);
+
+    /// @brief Erase a text field from x to right (exclusive) on a line
+    void clearField(uint8_t x, uint8_t baseline, uint8_t right);
+
+    /// @brief Send a value field (one tile row with sprites, text box otherwise)
+    void flushField(uint8_t x, uint8_t baseline, uint8_t right);
+#endif
+
+#if DISPLAY_BLIT_DIGITS
+    /**
+     * @brief Copy a PROGMEM sprite into one buffer page, plus a blank column.
+     * @return x after the sprite and gap
+     */
+    uint8_t blit(uint8_t x, uint8_t page, const uint8_t* sprite, uint8_t width);
+
+    /// @brief Blit a decimal value from digit sprites
+    uint8_t blitUInt(uint8_t x, uint8_t page, uint16_t value);
+#endif
+
+    /**
+     * @brief Send the tiles covering a pixel rectangle (full-buffer mode).
+     */
+    void flushArea(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+
+    /// @brief Bar length in px for a PWM%
+    static uint8_t barWidth(int pwmPercent);
+
+#if DISPLAY_ASYNC_FLUSH
+    /// @brief Dirty region in 8x8 tiles
+    struct TileRect
+    {
+        uint8_t tx, ty, tw, th;
+    };
+
+    static const uint8_t MAX_DIRTY = 4;
+    static const uint32_t I2C_CLOCK_HZ = 400000UL;
+
+    TileRect dirty[MAX_DIRTY];  ///< Regions queued for the next stream
+    uint8_t dirtyCount = 0;
+
+    // Stream cursor (advanced from the TWI interrupt)
+    uint8_t streamRect = 0;     ///< Index into dirty[]
+    uint8_t streamRow = 0;      ///< Tile row within the rect
+    bool streamCmdSent = false; ///< Position command sent for this row
+    uint8_t streamCmd[3];       ///< SSD1306 page/column command
+    uint16_t streamErrors = 0;  ///< I2cAsync::errors() already handled
+
+    static Display* streamOwner;
+
+    void queueTiles(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    void startStream();
+    static bool nextSegment(I2cSegment& seg);
+    static uint8_t i2cByte(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr);
+#endif
 };
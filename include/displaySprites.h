@@ -0,0 +1,59 @@
+/**
+ * @file displaySprites.h
+ * @brief Prerendered 5x7 digit and unit sprites in SSD1306 page format
+ * @version 1.0.0
+ *
+ * Each byte is one 8-pixel column of a display page, bit 0 = top row,
+ * exactly the layout of the U8g2 full frame buffer (and of the SSD1306
+ * GDDRAM). A sprite is therefore copied into the buffer byte for byte,
+ * with no glyph decoding. Glyphs use rows 0..6; row 7 stays blank so the
+ * glyph bottom sits on the text baseline when blitted to page
+ * (baseline - 6) / 8.
+ *
+ * Multi-letter units carry their own 1-column letter gaps.
+ * Included by display.cpp only (internal linkage, like displayStrings.h).
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+static const uint8_t SPRITE_GLYPH_W = 5;    ///< Columns per digit
+static const uint8_t SPRITE_SPACE_W = 3;    ///< Gap between value and unit
+
+static const uint8_t SPRITE_DIGITS[10][SPRITE_GLYPH_W] PROGMEM = {
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E },   // 0
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 },   // 1
+    { 0x42, 0x61, 0x51, 0x49, 0x46 },   // 2
+    { 0x21, 0x41, 0x45, 0x4B, 0x31 },   // 3
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 },   // 4
+    { 0x27, 0x45, 0x45, 0x45, 0x39 },   // 5
+    { 0x3C, 0x4A, 0x49, 0x49, 0x30 },   // 6
+    { 0x01, 0x71, 0x09, 0x05, 0x03 },   // 7
+    { 0x36, 0x49, 0x49, 0x49, 0x36 },   // 8
+    { 0x06, 0x49, 0x49, 0x29, 0x1E },   // 9
+};
+
+static const uint8_t SPRITE_PCT[] PROGMEM = {
+    0x23, 0x13, 0x08, 0x64, 0x62                        // %
+};
+
+static const uint8_t SPRITE_CM[] PROGMEM = {
+    0x38, 0x44, 0x44, 0x44, 0x20, 0x00,                 // c
+    0x7C, 0x04, 0x18, 0x04, 0x78                        // m
+};
+
+static const uint8_t SPRITE_FWD[] PROGMEM = {
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00,                 // F
+    0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00,                 // W
+    0x7F, 0x41, 0x41, 0x22, 0x1C                        // D
+};
+
+static const uint8_t SPRITE_REV[] PROGMEM = {
+    0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,                 // R
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,                 // E
+    0x1F, 0x20, 0x40, 0x20, 0x1F                        // V
+};
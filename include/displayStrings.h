@@ -0,0 +1,33 @@
+/**
+ * @file displayStrings.h
+ * @brief Constant display strings in flash, shared by the Display back ends
+ * @version 1.0.0
+ * 
+ * Included by exactly one translation unit per build (display.cpp for
+ * U8g2, displayU8x8.cpp for U8x8), so the internal-linkage tables are not
+ * duplicated in flash.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+static const char STR_TITLE[]          PROGMEM = "Motor Control";
+static const char STR_INIT[]           PROGMEM = "System Initializing...";
+static const char STR_ERR_TIMEOUT[]    PROGMEM = "ERROR: Timeout";
+static const char STR_ERR_HINT[]       PROGMEM = "Check sensor/wiring";
+static const char STR_RAW[]            PROGMEM = "Raw: ";
+static const char STR_NO_OBSTRUCTION[] PROGMEM = "No Obstruction";
+static const char STR_DISTANCE[]       PROGMEM = "Distance: ";
+static const char STR_CM[]             PROGMEM = " cm";
+static const char STR_PWM[]            PROGMEM = "PWM: ";
+static const char STR_PCT_FWD[]        PROGMEM = "% FWD";
+static const char STR_PCT_REV[]        PROGMEM = "% REV";
+static const char STR_HISTORY[]        PROGMEM = "History";
+
+// Short forms for the 16-column U8x8 text grid
+static const char STR_INIT_SHORT[]     PROGMEM = "Initializing...";
+static const char STR_ERR_HINT_SHORT[] PROGMEM = "Check sensor";
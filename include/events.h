@@ -0,0 +1,132 @@
+/**
+ * @file events.h
+ * @brief Pipeline events and a fixed-size lock-free SPSC event ring
+ * @version 1.0.0
+ *
+ * Event pipeline (EVENT_PIPELINE=1):
+ *
+ *     echo PCINT ──EVENT_RANGE──▶ control ──EVENT_SPEED_CHANGED────▶ LED, display
+ *                                         ──EVENT_DISTANCE_CHANGED─▶ display
+ *
+ * The echo capture interrupt posts the echo width when a measurement
+ * completes. The control stage recomputes only on a new range (or while
+ * a maneuver timer or kick pulse runs) and posts output events only when
+ * a value actually changed. Subscribers are a static table of
+ * (event type, handler) pairs, delivered by dispatchEvents().
+ *
+ * EventQueue is single producer / single consumer: one context pushes,
+ * one context pops. head is written only by the producer, tail only by
+ * the consumer, both are single bytes (atomic on AVR), and the slot copy
+ * is fenced before the index that publishes it, so no interrupt masking
+ * is needed. SIZE must be a power of two; one slot stays free to tell
+ * full from empty. A push into a full ring drops the event and counts it.
+ *
+ * Header-only and independent of the Arduino core.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <stdint.h>
+
+#ifndef EVENT_PIPELINE
+#define EVENT_PIPELINE 0        ///< 1 = interrupt echo capture + event-driven control/LED/display
+#endif
+
+/// @brief Event kinds
+enum EventType : uint8_t
+{
+    EVENT_RANGE = 0,            ///< Echo captured: value = echo width (µs)
+    EVENT_SPEED_CHANGED,        ///< Control output changed: value = speed % (int16_t)
+    EVENT_DISTANCE_CHANGED      ///< Distance used by control changed: value = cm
+};
+
+struct Event
+{
+    uint8_t type;               ///< EventType
+    uint16_t value;             ///< Payload (signed kinds: cast to int16_t)
+};
+
+/// @brief Subscription table entry
+struct EventSubscription
+{
+    uint8_t type;                           ///< EventType to receive
+    void (*handler)(const Event& e);        ///< Called in consumer context
+};
+
+template <uint8_t SIZE>
+class EventQueue
+{
+    static_assert(SIZE >= 2 && SIZE <= 128 && (SIZE & (SIZE - 1)) == 0,
+                  "EventQueue SIZE must be a power of two (2..128)");
+
+public:
+    /**
+     * @brief Producer side.
+     * @return false if the ring was full (event dropped)
+     */
+    bool push(const Event& e)
+    {
+        uint8_t h = head;
+        uint8_t next = (uint8_t)(h + 1) & (SIZE - 1);
+        if (next == tail)
+        {
+            if (drops != 0xFF) drops++;
+            return false;
+        }
+
+        slots[h] = e;
+        asm volatile("" ::: "memory");  // slot complete before it is published
+        head = next;
+        return true;
+    }
+
+    /**
+     * @brief Consumer side.
+     * @return false if the ring was empty
+     */
+    bool pop(Event& e)
+    {
+        uint8_t t = tail;
+        if (t == head)
+            return false;
+
+        asm volatile("" ::: "memory");  // read the slot only after seeing head
+        e = slots[t];
+        asm volatile("" ::: "memory");  // slot copied before it is released
+        tail = (uint8_t)(t + 1) & (SIZE - 1);
+        return true;
+    }
+
+    /// @brief Events dropped on a full ring (saturating)
+    uint8_t dropped() const { return drops; }
+
+private:
+    Event slots[SIZE];
+    volatile uint8_t head = 0;      ///< Next write (producer)
+    volatile uint8_t tail = 0;      ///< Next read (consumer)
+    volatile uint8_t drops = 0;     ///< Written by the producer
+};
+
+/// @brief Ring used by the pipeline stages
+typedef EventQueue<8> EventRing;
+
+/**
+ * @brief Drain a ring and call every handler subscribed to each event.
+ * Consumer context only.
+ */
+template <uint8_t SIZE>
+void dispatchEvents(EventQueue<SIZE>& queue, const EventSubscription* table, uint8_t entries)
+{
+    Event e;
+    while (queue.pop(e))
+    {
+        for (uint8_t i = 0; i < entries; i++)
+        {
+            if (table[i].type == e.type)
+                table[i].handler(e);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @file i2cAsync.h
+ * @brief Interrupt-driven, non-blocking TWI (I2C) master transmitter
+ * @version 1.0.0
+ * 
+ * Streams a sequence of write transactions ("segments") in the background
+ * from the TWI interrupt. Segments are pulled on demand from a source
+ * callback, so a caller can stream straight out of a large buffer (e.g. a
+ * display frame buffer) without copying it into a transmit queue.
+ * 
+ * Each segment is one addressed write, optionally prefixed by a single
+ * control byte (SSD1306 command/data selector), and segments are joined
+ * with repeated START. The last one ends with STOP and clears busy().
+ * 
+ * Replaces the Arduino Wire/twi driver for its user: Wire defines the
+ * same TWI interrupt vector, so builds that enable this driver must not
+ * link Wire (for U8g2: build with -D U8X8_NO_HW_I2C).
+ * 
+ * Compiled in only with DISPLAY_ASYNC_FLUSH=1 (build flag; the display's
+ * async flush is the driver's only user). The default lives here so the
+ * driver does not depend on display.h.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH 0   ///< 1 = stream dirty tiles from the TWI interrupt
+#endif
+
+/// @brief One I2C write transaction
+struct I2cSegment
+{
+    const uint8_t* data;    ///< Payload (must stay valid until sent)
+    uint8_t len;            ///< Payload length
+    uint8_t control;        ///< Control byte sent before the payload
+    bool useControl;        ///< Send control byte
+};
+
+/**
+ * @brief Segment source, called from interrupt context.
+ * @param seg Filled with the next segment
+ * @return false when there are no more segments
+ */
+typedef bool (*I2cSegmentSource)(I2cSegment& seg);
+
+class I2cAsync
+{
+public:
+    /**
+     * @brief Enable the TWI peripheral (SDA/SCL pull-ups on).
+     * @param clockHz SCL frequency, e.g. 400000
+     */
+    static void begin(uint32_t clockHz);
+
+    /**
+     * @brief Start streaming segments to a 7-bit address in the background.
+     * Waits for a previous stream to finish first.
+     */
+    static void start(uint8_t address, I2cSegmentSource source);
+
+    /**
+     * @brief Send one buffer and wait for completion (init / commands).
+     */
+    static void writeBlocking(uint8_t address, const uint8_t* data, uint8_t len);
+
+    /// @brief True while a stream is in progress
+    static bool busy();
+
+    /// @brief Transactions aborted by NACK / bus error since begin()
+    static uint16_t errors();
+};
@@ -6,6 +6,14 @@
  * Displays motor speed via color gradient:
  * - Red (0%) -> Yellow (50%) -> Green (100%)
  * - Smooth transitions with blinking effect on 50->0 transition
+ * - Transitions are time-based: exponential approach with time constant
+ *   TRANSITION_TAU_MS in Q8.8 fixed point, independent of update() rate
+ * - Effects (50->0 blink, error blink) are PROGMEM keyframe sequences
+ *   played on LedSequencer layers; faults override speed indication
+ * - Gradient colors come from a 101-entry PROGMEM table generated at
+ *   compile time (no float math on the target)
+ * - Gamma correction (γ = 2.5) on every channel in setRGB() so speed
+ *   changes read perceptually even; 256-entry PROGMEM table, no pow()
  * 
  * @author Michael Garcia, M&E Design
  * @contact michael@mandedesign.studio
@@ -16,6 +24,7 @@
 
 #pragma once
 #include <Arduino.h>
+#include "ledSequencer.h"
 
 class StatusLED
 {
@@ -40,24 +49,71 @@ public:
 private:
     static const uint8_t PIN_R = 3;   // Red LED on D3 (PWM)
     static const uint8_t PIN_G = 11;  // Green LED on D11 (PWM)
-    static const uint8_t PIN_B = 2;   // Blue LED on D2 (error indicator)
-    static const unsigned long STEP_INTERVAL_MS = 20;  // Color transition step delay
-    static const unsigned long BLINK_HALF_PERIOD_MS = 125;  // Blink timing
-    static const unsigned long ERROR_BLINK_MS = 500;  // Error blink period
+    static const uint8_t PIN_B = 2;   // Blue LED on D2 (error indicator, dimmable with LED_USE_BAM)
+    static const uint16_t TRANSITION_TAU_MS = 150;  // Color transition time constant (~5τ to settle)
+    static const uint16_t BLINK_HALF_PERIOD_MS = 125;  // Blink timing
+    static const uint16_t ERROR_BLINK_MS = 500;  // Error blink period
     static const uint8_t MAX_BRIGHTNESS = 255;
-    static const uint8_t DIM_BRIGHTNESS = 60;
+    // Blink dim phase, linear intensity: gamma 2.5 maps 143 to ~60/255
+    // duty, the same ~24% the blink showed before gamma correction
+    static const uint8_t DIM_BRIGHTNESS = 143;
     static const int COLOR_TRANSITION_THRESHOLD = 50;  // Midpoint for color gradient
 
-    int currentPercent = 0;    // Current LED state (0-100)
+    /// @brief One gradient table entry (blue is unused by the speed gradient)
+    struct GradientColor
+    {
+        uint8_t r;
+        uint8_t g;
+    };
+
+    /**
+     * @brief Gradient generator for the compile-time color table.
+     * 0% = Red (255,0), 50% = Yellow (255,255), 100% = Green (0,255)
+     */
+    static constexpr GradientColor gradientColor(uint16_t percent)
+    {
+        return (percent <= COLOR_TRANSITION_THRESHOLD)
+            ? GradientColor{ MAX_BRIGHTNESS,
+                             (uint8_t)(MAX_BRIGHTNESS * percent / COLOR_TRANSITION_THRESHOLD) }
+            : GradientColor{ (uint8_t)(MAX_BRIGHTNESS * (100 - percent) / COLOR_TRANSITION_THRESHOLD),
+                             MAX_BRIGHTNESS };
+    }
+
+    /// @brief Integer square root (binary search) for the gamma generator.
+    static constexpr uint32_t isqrt(uint32_t n, uint32_t lo = 0, uint32_t hi = 65536UL)
+    {
+        return (hi - lo <= 1)
+            ? lo
+            : (((lo + hi) / 2) * ((lo + hi) / 2) <= n)
+                ? isqrt(n, (lo + hi) / 2, hi)
+                : isqrt(n, lo, (lo + hi) / 2);
+    }
+
+    /**
+     * @brief Gamma generator for the compile-time gamma table.
+     * out = 255 * (in/255)^2.5, evaluated as in² · √in / 255^1.5 with
+     * √ scaled by 2^10 to keep precision in integer math.
+     */
+    static constexpr uint8_t gammaCorrect(uint16_t in)
+    {
+        return (uint8_t)(((uint32_t)in * in * isqrt((uint32_t)in << 20)
+                          + (MAX_BRIGHTNESS * isqrt((uint32_t)MAX_BRIGHTNESS << 20)) / 2)
+                         / (MAX_BRIGHTNESS * isqrt((uint32_t)MAX_BRIGHTNESS << 20)));
+    }
+
+    int16_t currentQ8 = 0;     // Current LED state (0-100, Q8.8)
+    int currentPercent = 0;    // Current LED state rounded (0-100)
     int targetPercent = 0;     // Target LED state (0-100)
     int lastCommand = 0;       // Last commanded speed
-    bool blinkingToZero = false;  // Special blink mode for 50->0
-    bool lastBlinkState = false;  // Blink toggle state
-    bool errorActive = false;      // Error mode active
-    bool errorBlinkOn = false;     // Error blink state
-    unsigned long lastStepMs = 0;       // Timer for color transitions
-    unsigned long lastBlinkMs = 0;      // Timer for blinking
-    unsigned long lastErrorBlinkMs = 0; // Timer for error blink
+    unsigned long lastUpdateMs = 0;     // Timer for color transitions
+
+    LedSequencer effects;              // Keyframe layers over the gradient
+
+    /// @brief Effect keyframe tables (PROGMEM, defined in led.cpp)
+    static const LedKeyframe BLINK_TO_ZERO_FRAMES[];
+    static const LedKeyframe ERROR_FRAMES[];
+    static const LedSequence BLINK_TO_ZERO_SEQ;
+    static const LedSequence ERROR_SEQ;
 
     /**
      * @brief Set RGB LED color values
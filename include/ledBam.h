@@ -0,0 +1,65 @@
+/**
+ * @file ledBam.h
+ * @brief Bit-angle modulation (BAM) driver for the RGB status LED
+ * @version 1.0.0
+ * 
+ * Dims all three LED channels from a single timer interrupt, including
+ * blue on D2, which has no hardware PWM. Enabled with LED_USE_BAM=1;
+ * otherwise StatusLED uses analogWrite() as before.
+ * 
+ * Timing (rides on Timer0, which the Arduino core already runs for millis()):
+ *  - Timer0 counts at 250kHz (4µs tick), period 256 ticks (1.024ms)
+ *  - begin() switches Timer0 from the core's Fast PWM to Normal mode.
+ *    In Fast PWM, OCR0B is double-buffered and a new compare value only
+ *    loads at BOTTOM, i.e. once per 1.024ms period; in Normal mode it
+ *    takes effect immediately. The overflow (millis/micros) is the same
+ *    256-tick period in both modes.
+ *  - OCR0B compare interrupt is advanced by each bit weight:
+ *        bit k lasts 2^k ticks → one 8-bit frame = 255 ticks
+ *        = 1.02ms (~980Hz), asynchronous to the overflow
+ *  - Bits 0..2 (4/8/16µs) are too short for separate interrupts; bits 0
+ *    and 1 are emitted inline with cycle-counted delays at frame start
+ *  - 6 interrupts per frame (~5900/s), fixed cost independent of the
+ *    duty values: frame start ~16µs (12µs of it inline bits), slots
+ *    3..7 ~3µs each → ~31µs per 1.02ms frame, about 3% CPU
+ *
+ * Consequences:
+ *  - Timer0 overflow (millis/micros) is unchanged
+ *  - analogWrite() on D5 (OC0B) and D6 (OC0A) no longer works (both are
+ *    plain digital pins here: ultrasonic TRIG / ECHO)
+ *  - Timer2 (D3/D11 hardware PWM) is no longer used by the LED and is
+ *    free for other uses
+ *  - Long interrupt handlers elsewhere should re-enable interrupts
+ *    (ISR_NOBLOCK) so a compare is not missed (missed = 1ms glitch)
+ *
+ * Pin mapping (must match StatusLED):
+ *  - R → D3  (PD3)
+ *  - G → D11 (PB3)
+ *  - B → D2  (PD2)
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef LED_USE_BAM
+#define LED_USE_BAM 0   ///< 1 = StatusLED drives pins through LedBam
+#endif
+
+class LedBam
+{
+public:
+    /**
+     * @brief Configure pins and start the compare interrupt.
+     */
+    static void begin();
+
+    /**
+     * @brief Set pin-level duty for each channel (0 = always LOW,
+     *        255 = always HIGH). Takes effect at the next frame start.
+     */
+    static void write(uint8_t r, uint8_t g, uint8_t b);
+};
@@ -0,0 +1,124 @@
+/**
+ * @file ledSequencer.h
+ * @brief Keyframe-driven LED animation engine with priority layers
+ * @version 1.0.0
+ * 
+ * Effects are data, not code: a sequence is a PROGMEM table of keyframes
+ * (color, duration, easing) plus a blend mode and a loop flag. The
+ * sequencer plays one sequence per layer and composes the layers over a
+ * base color (the speed gradient) in priority order:
+ * 
+ *     base color → LAYER_TRANSITION → LAYER_FAULT → output
+ * 
+ * Blend modes:
+ *  - LED_BLEND_REPLACE : keyframe color replaces everything below
+ *  - LED_BLEND_SCALE   : keyframe channels scale the color below
+ *                        (255 = unchanged, 0 = off), e.g. a dim/bright blink
+ * 
+ * Easing:
+ *  - LED_EASE_STEP   : hold the keyframe color for its duration
+ *  - LED_EASE_LINEAR : interpolate toward the next keyframe
+ * 
+ * Duration 0 holds that keyframe's color until stop() or the next
+ * play() on the layer (e.g. a latched fault color after a blink-in).
+ * 
+ * A new status pattern is a new keyframe table and a play() call; the
+ * per-tick render path has no effect-specific branches.
+ * 
+ * Independent of the Arduino core (only avr/pgmspace.h on AVR; tables
+ * in ordinary memory on the host), so it runs under `pio test -e native`.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+
+enum LedEasing : uint8_t
+{
+    LED_EASE_STEP = 0,
+    LED_EASE_LINEAR
+};
+
+enum LedBlend : uint8_t
+{
+    LED_BLEND_REPLACE = 0,
+    LED_BLEND_SCALE
+};
+
+/// @brief One animation step (stored in PROGMEM)
+struct LedKeyframe
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t easing;         ///< LedEasing
+    uint16_t durationMs;    ///< Time spent in this keyframe (0 = hold)
+};
+
+/// @brief Keyframe table descriptor (stored in PROGMEM)
+struct LedSequence
+{
+    const LedKeyframe* frames;  ///< PROGMEM keyframe table
+    uint8_t count;              ///< Number of keyframes
+    uint8_t blend;              ///< LedBlend
+    bool loop;                  ///< Restart after the last keyframe
+};
+
+class LedSequencer
+{
+public:
+    /// @brief Layers in ascending priority (higher index is composed last)
+    enum Layer : uint8_t
+    {
+        LAYER_TRANSITION = 0,   ///< Speed-change effects
+        LAYER_FAULT,            ///< Fault codes, override speed indication
+        LAYER_COUNT
+    };
+
+    /**
+     * @brief Start a sequence on a layer (restarts if already playing it).
+     * @param layer Target layer
+     * @param sequence PROGMEM sequence descriptor
+     * @param now Current millis()
+     */
+    void play(Layer layer, const LedSequence* sequence, unsigned long now);
+
+    /**
+     * @brief Stop the sequence on a layer.
+     */
+    void stop(Layer layer);
+
+    /**
+     * @brief True while a sequence is active on the layer.
+     */
+    bool isPlaying(Layer layer) const { return layers[layer].count != 0; }
+
+    /**
+     * @brief Compose active layers over the base color.
+     * One-shot sequences stop themselves after their last keyframe.
+     * @param r,g,b In: base color, out: composed color
+     * @param now Current millis()
+     */
+    void render(uint8_t& r, uint8_t& g, uint8_t& b, unsigned long now);
+
+private:
+    /// @brief Playback state per layer (descriptor cached from PROGMEM)
+    struct LayerState
+    {
+        const LedKeyframe* frames = nullptr;
+        uint8_t count = 0;          ///< 0 = layer idle
+        uint8_t blend = LED_BLEND_REPLACE;
+        bool loop = false;
+        uint8_t index = 0;          ///< Current keyframe
+        unsigned long frameStartMs = 0;
+    };
+
+    LayerState layers[LAYER_COUNT];
+};
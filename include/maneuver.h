@@ -0,0 +1,112 @@
+/**
+ * @file maneuver.h
+ * @brief Table-driven maneuver state machine (flash table + tiny engine)
+ * @version 1.0.0
+ *
+ * The maneuver logic is data: a transition table of
+ * (state, guard, action, timeout, next state) rows in flash, interpreted
+ * by ManeuverEngine. For the current state the engine takes the first row
+ * whose guard holds, switches to its next state (restarting the state
+ * timer on a change) and outputs the row's action. Each state ends with
+ * an ALWAYS row, so every step produces an output; a state with no
+ * matching row stops the motor.
+ *
+ * Adding a behavior = adding rows (and, if needed, a guard or action).
+ *
+ * Independent of the Arduino core: only <stdint.h>, plus avr/pgmspace.h
+ * on AVR. On the host the table lives in ordinary memory, so the engine
+ * and table compile and run there unchanged for exhaustive tests.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define MANEUVER_PROGMEM PROGMEM
+#else
+#define MANEUVER_PROGMEM
+#endif
+
+/// @brief Maneuver states (values shown on the motor page)
+enum ManeuverState : uint8_t
+{
+    MANEUVER_NORMAL = 0,    ///< Dynamic distance → speed mapping
+    MANEUVER_STOPPING,      ///< Stopped before reversing
+    MANEUVER_REVERSING,     ///< Timed reverse
+    MANEUVER_SLOW_FORWARD,  ///< Creep forward until back in range
+    MANEUVER_STATE_COUNT
+};
+
+/// @brief Row conditions
+enum ManeuverGuard : uint8_t
+{
+    GUARD_ALWAYS = 0,       ///< Unconditional (stay / default row)
+    GUARD_IN_RANGE,         ///< distance < MAX_DIST_CM
+    GUARD_OUT_OF_RANGE,     ///< distance >= MAX_DIST_CM
+    GUARD_TIMEOUT           ///< Time in state >= row timeoutMs
+};
+
+/// @brief Row outputs
+enum ManeuverAction : uint8_t
+{
+    ACTION_MAP = 0,         ///< Map distance to 0..100% (2% steps)
+    ACTION_STOP,            ///< 0%
+    ACTION_REVERSE,         ///< -REVERSE_PCT
+    ACTION_CREEP            ///< +CREEP_PCT
+};
+
+/// @brief One transition table row (6 bytes in flash)
+struct ManeuverTransition
+{
+    uint8_t state;          ///< ManeuverState the row applies to
+    uint8_t guard;          ///< ManeuverGuard
+    uint8_t action;         ///< ManeuverAction output when the row fires
+    uint16_t timeoutMs;     ///< For GUARD_TIMEOUT
+    uint8_t next;           ///< ManeuverState after the row fires
+};
+
+/// @brief Default maneuver: STOP (500ms) → REVERSE (200ms) → SLOW-FWD
+extern const ManeuverTransition MANEUVER_TABLE[] MANEUVER_PROGMEM;
+extern const uint8_t MANEUVER_TABLE_ROWS;
+
+class ManeuverEngine
+{
+public:
+    static const int MIN_DIST_CM = 5;       ///< Distance where commanded = 0%
+    static const int MAX_DIST_CM = 60;      ///< Distance where commanded = 100%
+    static const int REVERSE_PCT = 20;      ///< Reverse speed
+    static const int CREEP_PCT = 20;        ///< Slow forward speed
+
+    /**
+     * @param table Transition table (flash on AVR)
+     * @param rows Number of rows
+     */
+    ManeuverEngine(const ManeuverTransition* table, uint8_t rows);
+
+    /**
+     * @brief Evaluate one step.
+     * @param distance Latest distance in cm (0 = no obstruction)
+     * @param nowMs Current time (ms, wrap-safe)
+     * @return Commanded speed -100..100
+     */
+    int step(int distance, uint32_t nowMs);
+
+    ManeuverState state() const { return current; }
+
+    /// @brief Distance → speed mapping used by ACTION_MAP
+    static int mapDistance(int distance);
+
+private:
+    const ManeuverTransition* table;
+    uint8_t rows;
+    ManeuverState current = MANEUVER_NORMAL;
+    uint32_t enteredMs = 0;     ///< Time the current state was entered
+
+    bool guardHolds(const ManeuverTransition& t, int distance, uint32_t nowMs) const;
+    static int output(uint8_t action, int distance);
+};
@@ -11,6 +11,15 @@
  * 
  * EN pin is tied high with 10kΩ resistor (always enabled).
  * 
+ * Supply compensation: the duty for a given percent is scaled by
+ * NOMINAL_SUPPLY_MV / actual supply, so setSpeed(50) delivers the same
+ * average motor voltage across the battery discharge curve.
+ * 
+ * Kick-start: when the motor starts from standstill (or reverses) with a
+ * low command, a short high-duty pulse breaks static friction before the
+ * output settles to the commanded duty. Timing is millis()-based and
+ * ended from update(), no delay().
+ * 
  * @author Michael Garcia, M&E Design
  * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
  * @license MIT License
@@ -50,6 +59,53 @@ public:
      */
     void brake();
 
+    /**
+     * @brief Drive the bridge off from any context, watchdog ISR included.
+     *
+     * Disconnects Timer1 from D9/D10 and drives both inputs LOW with
+     * direct register writes, then latches the outputs off: later
+     * setSpeed()/update() calls leave the bridge alone until the next
+     * reset, so a control tick preempted by the watchdog ISR cannot
+     * restart the motor.
+     */
+    static void emergencyStop();
+
+    /**
+     * @brief Update the measured motor supply voltage.
+     * 
+     * The compensation gain (nominal / actual) is cached and only
+     * recomputed when the reading changes. If the gain changes while the
+     * motor is running, the current command is re-applied.
+     * 
+     * @param millivolts Motor supply voltage (0 = unknown → no compensation)
+     */
+    void setSupplyMillivolts(uint16_t millivolts);
+
+    /**
+     * @brief Configure the stiction kick-start pulse for this unit.
+     * 
+     * @param percent    Kick duty (1..100). Commands at or above this
+     *                   start without a kick.
+     * @param durationMs Kick length in ms (0 disables the kick).
+     */
+    void setKickStart(uint8_t percent, uint16_t durationMs);
+
+    /**
+     * @brief Service time-based behavior (ends the kick pulse).
+     * Call every loop tick; non-blocking.
+     */
+    void update();
+
+    /// @brief Last commanded speed after deadband [-100..100]
+    int command() const { return lastCommandPercent; }
+
+    /// @brief Duty on the bridge after kick and supply compensation
+    ///        [-255..255], sign = direction
+    int appliedDuty() const { return appliedPwm; }
+
+    /// @brief True while the kick-start pulse is applied
+    bool kicking() const { return kickActive; }
+
 private:
     static const uint8_t IN1 = 9;   ///< L293D Input 1 (PWM capable)
     static const uint8_t IN2 = 10;  ///< L293D Input 2 (PWM capable)
@@ -58,7 +114,34 @@ private:
     ///        Values with |percent| < DEAD_BAND_PERCENT are treated as 0.
     static const uint8_t DEAD_BAND_PERCENT = 3;
 
+    /// @brief Supply voltage the percent→duty mapping is calibrated for.
+    static const uint16_t NOMINAL_SUPPLY_MV = 9000;
+
+    /// @brief Below this the reading is treated as invalid (e.g. motor
+    ///        supply unplugged) and compensation is disabled.
+    static const uint16_t MIN_SUPPLY_MV = 4000;
+
+    /// @brief Upper limit for the compensation gain (Q8.8, 512 = 2.0x).
+    static const uint16_t MAX_SUPPLY_GAIN_Q8 = 512;
+
+    /// @brief Default kick-start duty and length (tune per unit via setKickStart()).
+    static const uint8_t DEFAULT_KICK_PERCENT = 60;
+    static const uint16_t DEFAULT_KICK_MS = 40;
+
     int lastCommandPercent = 0;     ///< Last commanded speed [-100..100]
 
+    uint8_t kickPercent = DEFAULT_KICK_PERCENT;  ///< Kick duty [%]
+    uint16_t kickMs = DEFAULT_KICK_MS;           ///< Kick length [ms]
+    bool kickActive = false;        ///< Kick pulse currently applied
+    unsigned long kickStartMs = 0;  ///< Kick pulse start time
+
+    uint16_t lastSupplyMv = 0;      ///< Last supply reading seen
+    uint16_t supplyGainQ8 = 256;    ///< Cached nominal/actual (Q8.8)
+
+    int16_t appliedPwm = 0;         ///< Duty last written to the bridge
+
+    static volatile bool outputsLatchedOff;     ///< Set by emergencyStop()
+
+    void applyCommand();
     void applyOutputs(int pwmValue, bool forward);
 };
@@ -0,0 +1,108 @@
+/**
+ * @file profiler.h
+ * @brief Compile-time optional per-stage execution profiler
+ * @version 1.0.0
+ *
+ * PROFILE_ENABLED=1 brackets the control pipeline stages (readCM,
+ * control step, setSpeed/update, LED update, display update) with
+ * PROFILE_START / PROFILE_STOP. Per stage it keeps, in fixed-size
+ * counters:
+ *  - min / max / sum (average) execution time and a run count
+ *  - a 6-bin histogram with 4x steps: <16, <64, <256, <1024, <4096,
+ *    >=4096 µs
+ * Nothing wraps: once a stage's run count reaches 0xFFFF (~11 min at
+ * 100 Hz without a dump) the stage stops recording, so min/avg/max and
+ * the histogram stay one consistent window. Profiler::dumpLine() prints the
+ * table over serial ('f') a line at a time, clearing each stage as it
+ * goes, so a dump starts a new window. Each stage takes two lines
+ * (timing, then histogram) so no line outgrows the 64-byte TX buffer.
+ *
+ * Timestamps are micros() (4µs resolution at 16 MHz). Timer1 cannot be
+ * used as a cycle counter here: it runs the D9/D10 motor PWM in
+ * phase-correct mode and counts up and down.
+ *
+ * With PROFILE_ENABLED=0 (default) the macros expand to nothing and no
+ * profiler code or RAM is linked in.
+ *
+ * In a CONTROL_TIMER_ISR build the control and setSpeed stages are
+ * recorded inside the Timer2 interrupt; dumpLine() copies each stage with
+ * interrupts off.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 0       ///< 1 = per-stage timing ('f' over serial)
+#endif
+
+/// @brief Profiled stages (dump order)
+enum ProfileStage : uint8_t
+{
+    PROF_READ_CM = 0,       ///< usonic.readCM()
+    PROF_CONTROL,           ///< controller.step()
+    PROF_SET_SPEED,         ///< motor.setSpeed() + motor.update()
+    PROF_LED,               ///< statusLed update
+    PROF_DISPLAY,           ///< display.update()
+    PROF_STAGE_COUNT
+};
+
+#if PROFILE_ENABLED
+
+/// @brief Statistics for one stage (since the last dump)
+struct ProfileStats
+{
+    uint16_t minUs;
+    uint16_t maxUs;
+    uint32_t sumUs;
+    uint16_t runs;
+    uint16_t bins[6];       ///< Profiler::HIST_BINS
+};
+
+class Profiler
+{
+public:
+    static const uint8_t HIST_BINS = 6;
+
+    /// @brief Longest dumpLine() output incl. CRLF: name + 6 bins of " 65535"
+    static const uint8_t DUMP_LINE_MAX = 8 + HIST_BINS * 6 + 2;
+
+    /// @brief Stage start timestamp
+    static uint16_t start() { return (uint16_t)micros(); }
+
+    /**
+     * @brief Record one run of a stage.
+     * @param stage ProfileStage
+     * @param startUs Value returned by start()
+     */
+    static void record(uint8_t stage, uint16_t startUs);
+
+    /// @brief Clear all stages
+    static void reset();
+
+    /**
+     * @brief Print one line of the table: lines 0-1 are the headers,
+     *        line 2 + 2i is stage i's runs/min/avg/max (the stage is
+     *        copied and cleared there) and line 3 + 2i its histogram.
+     * @return false once past the last line (nothing printed)
+     */
+    static bool dumpLine(Print& out, uint8_t line);
+
+private:
+    static ProfileStats stages[PROF_STAGE_COUNT];
+    static ProfileStats dumped;     ///< Stage being printed
+};
+
+#define PROFILE_START(stage)  uint16_t profStart_##stage = Profiler::start()
+#define PROFILE_STOP(stage)   Profiler::record(stage, profStart_##stage)
+
+#else
+
+#define PROFILE_START(stage)  do {} while (0)
+#define PROFILE_STOP(stage)   do {} while (0)
+
+#endif
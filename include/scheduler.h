@@ -0,0 +1,113 @@
+/**
+ * @file scheduler.h
+ * @brief Cooperative static task table scheduler (no heap)
+ * @version 1.0.0
+ *
+ * Tasks live in a caller-owned static array. Each task has:
+ *  - periodMs : release interval (0 = background, runs when nothing is due)
+ *  - phaseMs  : offset of the first release, to spread tasks apart
+ *  - priority : 0 = most urgent; picks among tasks due at the same time
+ *
+ * dispatch() runs at most one periodic task per call (the most urgent
+ * due one), so a slow low-priority task delays a control release by at
+ * most its own run time, never by a whole chain of stages. When nothing
+ * is due, background tasks run.
+ *
+ * Per task, the scheduler records execution time (last/min/max and a
+ * sum for the average over a window the caller clears) and deadline
+ * misses: a run that finishes a full period or more after its release
+ * (total, and consecutive for the deadline monitor in watchdog.h).
+ * A task that falls more than one period behind skips the lost releases
+ * instead of running back to back.
+ *
+ * Idle sleep (SCHED_IDLE_SLEEP=1, default): when no periodic task is due
+ * after the background tasks, the CPU enters SLEEP_MODE_IDLE. The due
+ * check runs with interrupts disabled, so a tick arriving after it stays
+ * pending and ends the sleep at once. Timers (motor/LED PWM, millis),
+ * USART, TWI and pin-change interrupts keep running and any interrupt
+ * wakes the CPU; the Timer0 overflow (every 1.024ms) bounds the wake-up,
+ * so a release is at most ~1ms late. load() is the awake
+ * share of the last LOAD_WINDOW_MS; interrupts taken during sleep count
+ * as asleep.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef SCHED_IDLE_SLEEP
+#define SCHED_IDLE_SLEEP 1      ///< 1 = SLEEP_MODE_IDLE while nothing is due
+#endif
+
+/// @brief Per-task runtime state and statistics (zero-initialized)
+struct SchedStats
+{
+    unsigned long releaseMs;            ///< Next release time
+    uint16_t lastUs;                    ///< Last execution time
+    uint16_t minUs;                     ///< Window minimum
+    uint16_t maxUs;                     ///< Window maximum
+    uint32_t sumUs;                     ///< Window sum (for the average)
+    uint16_t runs;                      ///< Runs in the window (saturates; sum stops with it)
+    uint16_t misses;                    ///< Deadline misses since begin()
+    uint8_t lateRuns;                   ///< Consecutive misses (0 = last run on time)
+};
+
+/// @brief Task table entry; the table sets the first four fields and `{}`
+struct SchedTask
+{
+    void (*run)(unsigned long now);     ///< Task body (now = release check time)
+    uint16_t periodMs;                  ///< 0 = background
+    uint16_t phaseMs;                   ///< First release after begin()
+    uint8_t priority;                   ///< 0 = highest
+    SchedStats stats;                   ///< Runtime state
+};
+
+class Scheduler
+{
+public:
+    /**
+     * @param table Static task table
+     * @param entries Number of entries
+     */
+    Scheduler(SchedTask* table, uint8_t entries);
+
+    /// @brief Set first releases from each task's phase, reset statistics
+    void begin();
+
+    /**
+     * @brief Run the most urgent due task, or the background tasks.
+     * Call from loop(); never blocks.
+     */
+    void dispatch();
+
+    /// @brief Runtime statistics of a task
+    const SchedStats& stats(uint8_t index) const { return tasks[index].stats; }
+
+    /// @brief Restart the min/avg/max window of a task
+    void clearWindow(uint8_t index);
+
+#if SCHED_IDLE_SLEEP
+    static const uint16_t LOAD_WINDOW_MS = 1000;    ///< CPU load averaging window
+
+    /// @brief CPU load: awake time in the last complete window [%]
+    uint8_t load() const { return loadPct; }
+#endif
+
+private:
+    SchedTask* tasks;
+    uint8_t count;
+
+#if SCHED_IDLE_SLEEP
+    unsigned long windowStartMs = 0;    ///< Start of the current load window
+    unsigned long sleptUs = 0;          ///< Time asleep in the current window
+    uint8_t loadPct = 100;
+
+    bool anyDue(unsigned long now) const;
+    void idleSleep();                   ///< Sleep unless a task is due (checked under cli)
+#endif
+
+    void execute(SchedTask& t, unsigned long now);
+};
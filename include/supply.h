@@ -0,0 +1,67 @@
+/**
+ * @file supply.h
+ * @brief Motor supply voltage monitor (ADC through resistor divider)
+ * @version 1.0.0
+ * 
+ * Samples the motor battery through a resistive divider on A0 using the
+ * ADC in the background: a conversion is started, and update() only
+ * collects the result once the hardware has finished (no analogRead()
+ * busy-wait in the control loop).
+ * 
+ * Divider (default):
+ *  - R_TOP    = 30kΩ  (battery + → A0)
+ *  - R_BOTTOM = 10kΩ  (A0 → GND)
+ *  - Ratio 4:1, so 0–20V battery maps to 0–5V at the pin
+ * 
+ * Readings are low-pass filtered and quantized to SUPPLY_STEP_MV so that
+ * consumers (Motor compensation) only see a change when the battery
+ * voltage actually moves, not on every bit of ADC noise.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+class SupplyMonitor
+{
+public:
+    /**
+     * @brief Configure the ADC for the supply channel and start the
+     *        first conversion.
+     */
+    void begin();
+
+    /**
+     * @brief Collect a finished conversion (if any) and start the next one.
+     * Non-blocking: returns immediately while a conversion is in progress.
+     */
+    void update();
+
+    /**
+     * @brief Filtered supply voltage in millivolts, quantized to SUPPLY_STEP_MV.
+     * @return 0 until the first conversion has completed
+     */
+    uint16_t millivolts() const { return supplyMv; }
+
+private:
+    static const uint8_t ADC_CHANNEL = 0;       ///< A0
+
+    static const uint16_t R_TOP_KOHM    = 30;   ///< Divider upper resistor
+    static const uint16_t R_BOTTOM_KOHM = 10;   ///< Divider lower resistor
+    static const uint16_t VREF_MV       = 5000; ///< AVcc reference
+
+    /// Reported voltage resolution (mV)
+    static const uint16_t SUPPLY_STEP_MV = 50;
+
+    /// EMA filter shift: new = old + (sample - old) / 2^FILTER_SHIFT
+    static const uint8_t FILTER_SHIFT = 3;
+
+    uint32_t filteredMvQ4 = 0;   ///< Filter state, mV in Q.4
+    uint16_t supplyMv = 0;       ///< Last published (quantized) value
+    bool primed = false;         ///< First sample loads the filter directly
+
+    void startConversion();
+};
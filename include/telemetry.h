@@ -0,0 +1,45 @@
+/**
+ * @file telemetry.h
+ * @brief Shared telemetry snapshot read by the display pages
+ * @version 1.0.0
+ *
+ * Written by main.cpp at the end of the control tick (fields owned by
+ * control) and right before each display refresh (loop timing window),
+ * read by Display::update(). Plain data, no behavior: each display page
+ * renders only the fields it shows.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+#include "ultraSonic.h"
+#include "maneuver.h"
+
+struct Telemetry
+{
+    // Main page
+    int distance;           ///< cm (0 = no obstruction / invalid)
+    int speedPct;           ///< Commanded speed -100..100
+    bool error;             ///< Sensor / system fault
+
+    // Loop timing page (window since the previous display refresh)
+    uint16_t tickMinUs;     ///< Shortest control tick
+    uint16_t tickAvgUs;     ///< Mean control tick
+    uint16_t tickMaxUs;     ///< Longest control tick
+    uint16_t overruns;      ///< Control deadline misses since boot: runs that finished a
+                            ///< period or more after release (lost releases included)
+    const char* resetReason;///< Last reset cause (PROGMEM), nullptr = power-on
+
+    // Sensor health page
+    UltraSonic::Stats sensor;
+
+    // Motor page
+    ManeuverState mode;     ///< Maneuver state
+    int target;             ///< Speed command after deadband
+    int duty;               ///< Applied bridge duty -255..255
+    bool kick;              ///< Kick-start pulse active
+    uint16_t supplyMv;      ///< Filtered motor supply
+};
@@ -0,0 +1,46 @@
+/**
+ * @file textFormat.h
+ * @brief Allocation-free integer → ASCII formatting for display labels
+ * @version 1.0.0
+ * 
+ * Small replacements for snprintf("%d") that write straight into a
+ * caller's buffer and return the new end, so a label is built by
+ * chaining calls:
+ * 
+ *     char* p = appendP(buf, PSTR("PWM: "));
+ *     p = formatInt(p, pwm);
+ *     p = appendP(p, PSTR("% FWD"));
+ * 
+ * Avoids linking vfprintf (~1.5KB flash on AVR) and formats a 3-digit
+ * value in a few hundred cycles instead of several thousand.
+ * All functions NUL-terminate and return a pointer to the terminator.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Format an unsigned value in decimal.
+ * @param dst Destination (needs width or 5 chars, whichever is larger, + 1)
+ * @param value Value to format
+ * @param width Minimum field width, right-aligned (0 = no padding)
+ * @param pad Padding character (' ' or '0')
+ * @return Pointer to the terminating NUL
+ */
+char* formatUInt(char* dst, uint16_t value, uint8_t width = 0, char pad = ' ');
+
+/**
+ * @brief Format a signed value in decimal ('-' prefix when negative).
+ * @return Pointer to the terminating NUL
+ */
+char* formatInt(char* dst, int value, uint8_t width = 0, char pad = ' ');
+
+/**
+ * @brief Append a PROGMEM string.
+ * @return Pointer to the terminating NUL
+ */
+char* appendP(char* dst, const char* progmemStr);
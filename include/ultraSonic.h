@@ -25,8 +25,16 @@
  *  - Returns last stable value if polled faster
  *  - Converts valid echo durations to cm using integer-friendly 1/58 scaling
  *  - Converts invalid, out-of-range, or timeout readings to distance = 0
+ *  - Counts readings, timeouts, out-of-range echoes and a coarse
+ *    distance histogram for the diagnostics page (stats())
  *  - Distance = 0 means:
  *        "no obstruction" OR "timeout / invalid / beyond useful range"
+ *  - EVENT_PIPELINE=1: ping() triggers without waiting; a pin-change
+ *    interrupt on ECHO timestamps both edges and posts EVENT_RANGE
+ *    (echo width) to the ring given to begin(). The loop converts it
+ *    with toCM(), which applies the same filtering and counters. A ping
+ *    whose echo never ends before the next one is reported by ping()
+ *    and goes through toCM(0): a timeout, distance 0, as with pulseIn().
  * 
  * Design intent:
  *  - Class is **non-blocking**, **safe**, and **deterministic**
@@ -61,10 +69,23 @@
 
 #pragma once
 #include <Arduino.h>
+#include "events.h"
 
 class UltraSonic
 {
 public:
+    /// @brief Distance histogram bins: <20, 20-59, 60-149, >=150 cm
+    static const uint8_t HIST_BINS = 4;
+
+    /// @brief Sensor health counters (saturating, since begin())
+    struct Stats
+    {
+        uint16_t readings;          ///< Trigger/echo cycles run
+        uint16_t timeouts;          ///< No echo within ECHO_TIMEOUT_US
+        uint16_t outOfRange;        ///< Echo outside 2..400 cm
+        uint16_t bins[HIST_BINS];   ///< Valid readings per distance bin
+    };
+
     void begin();
 
     /**
@@ -76,6 +97,31 @@ public:
      */
     int readCM();
 
+    /**
+     * @brief Convert an echo width to centimeters, with range filtering
+     *        and health counters (same return values as readCM()).
+     * @param echoUs Echo HIGH time (0 or > ECHO_TIMEOUT_US = timeout)
+     */
+    int toCM(unsigned long echoUs);
+
+#if EVENT_PIPELINE
+    /// @brief Enable echo capture; completed echoes go to queue (ISR producer)
+    void begin(EventRing& queue);
+
+    /**
+     * @brief Trigger a measurement if MIN_INTERVAL_MS has passed (never waits for the echo).
+     * @return true if the previous ping's echo never completed; feed
+     *         toCM(0) so it counts and reads as a timeout (distance 0)
+     */
+    bool ping();
+
+    /// @brief Echo pin-change ISR body
+    static void echoIsr();
+#endif
+
+    /// @brief Health counters and distance histogram
+    const Stats& stats() const { return health; }
+
 private:
     static const uint8_t trigPin = 5;   ///< TRIG on D5
     static const uint8_t echoPin = 6;   ///< ECHO on D6
@@ -91,4 +137,8 @@ private:
 
     /// Last stable validated distance returned to caller
     int lastDistance = 0;
+
+    Stats health = {};
+
+    static void count(uint16_t& counter);
 };
@@ -0,0 +1,73 @@
+/**
+ * @file watchdog.h
+ * @brief Hardware watchdog + control deadline monitor with safe stop
+ * @version 1.0.0
+ *
+ * Two layers guard against a hang (pulseIn, I2C, a future bug) leaving
+ * the motor at its last duty:
+ *  - Deadline monitor: check() runs at the start of every control run
+ *    with the scheduler's count of consecutive control deadline misses.
+ *    The hardware watchdog is petted only while the last run met its
+ *    deadline. After MAX_LATE_RUNS misses in a row check() trips once;
+ *    the caller stops the motor, and the monitor stops petting for good.
+ *    Only runs that finish are counted, so this catches a control task
+ *    that keeps running late, not one that never runs again.
+ *  - Hardware watchdog (~250ms) in interrupt + reset mode: when nothing
+ *    pets it (a hang anywhere in loop(), starvation, or after a trip),
+ *    the first timeout calls the onTimeout handler from WDT_vect, which
+ *    stops the motor at register level; the next timeout resets the
+ *    board. The interrupt also latches the monitor: if control recovers
+ *    in between, its next check() trips (error shown) and never pets
+ *    again, so the reset still happens. A hang with interrupts disabled cannot take WDT_vect and
+ *    only gets the reset, ~500ms after the last pet.
+ *
+ * Reset reason: MCUSR is captured in .init3, before the C runtime
+ * clears RAM, and the watchdog is switched off there (it stays armed at
+ * 15ms after a watchdog reset). Bootloader requirement: the cause is
+ * only exact when the board is flashed over ISP (no bootloader), which
+ * leaves MCUSR intact. A bootloader clears MCUSR first; Optiboot v6+
+ * passes it on in r2, used when MCUSR reads 0 and r2 holds only defined
+ * reset bits. Even then a DTR/upload reset reads as WDT, because
+ * Optiboot leaves through its own watchdog reset. Bootloaders that pass
+ * nothing (older Optiboot on stock Unos) give "UNK".
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#pragma once
+#include <Arduino.h>
+
+class Watchdog
+{
+public:
+    static const uint8_t MAX_LATE_RUNS = 5;    ///< Consecutive control misses before safe stop
+
+    /**
+     * @brief Arm the hardware watchdog (call last in setup()).
+     * @param onTimeout Called from WDT_vect on the first timeout, with
+     *                  interrupts disabled: register writes only
+     */
+    void begin(void (*onTimeout)());
+
+    /**
+     * @brief Deadline check, once per control run.
+     * @param lateRuns Consecutive control deadline misses so far
+     * @return true exactly once, when the safe stop must be applied
+     *         (MAX_LATE_RUNS misses, or the watchdog interrupt has run)
+     */
+    bool check(uint8_t lateRuns);
+
+    /// @brief Safe stop latched; waiting for the watchdog reset
+    bool tripped() const { return safeStop; }
+
+    /// @brief MCUSR at boot (PORF / EXTRF / BORF / WDRF bits), 0x80 if unknown
+    static uint8_t resetFlags();
+
+    /// @brief Reset cause ("WDT", "BOR", "EXT", "UNK", PROGMEM), nullptr for power-on
+    static const char* resetReason();
+
+private:
+    bool safeStop = false;
+};
@@ -0,0 +1,146 @@
+/**
+ * @file control.cpp
+ * @brief Control law and Timer2 control tick
+ * @version 1.0.0
+ *
+ * Controller::step() evaluates the maneuver table (maneuver.cpp):
+ * dynamic 5–60cm → 0–100% mapping with 2% quantization, and the
+ * millis-timed STOP → REVERSE → SLOW_FORWARD maneuver when
+ * distance >= MAX_DIST_CM.
+ *
+ * Timer2 setup (CONTROL_TIMER_ISR): CTC mode, prescaler 1024 → 15625 Hz,
+ * OCR2A = 155 → 100.16 Hz (9.984 ms period). The ISR is ISR_NOBLOCK so
+ * the LedBam Timer0 compare can still preempt it.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "control.h"
+#include "profiler.h"
+
+int Controller::step(int distance, unsigned long now)
+{
+    return maneuver.step(distance, (uint32_t)now);
+}
+
+#if CONTROL_TIMER_ISR
+
+#include <avr/interrupt.h>
+
+namespace
+{
+    Controller* ctl = nullptr;
+    Motor* out = nullptr;
+
+    // loop → ISR
+    volatile uint8_t inSeq = 0;
+    volatile int inDistance = 0;
+    volatile uint16_t inSupplyMv = 0;
+
+    // ISR-private copy of the last consistent inputs
+    int isrDistance = 0;
+    uint16_t isrSupplyMv = 0;
+
+    // ISR → loop
+    volatile uint8_t outSeq = 0;
+    ControlOutputs outBuf = {};
+}
+
+void ControlTick::begin(Controller& controller, Motor& motor)
+{
+    ctl = &controller;
+    out = &motor;
+
+    uint8_t sreg = SREG;
+    cli();
+    TCCR2A = _BV(WGM21);                        // CTC, no pin outputs
+    TCCR2B = _BV(CS22) | _BV(CS21) | _BV(CS20); // clk/1024 = 15625 Hz
+    OCR2A = (uint8_t)(15625U / CONTROL_ISR_HZ - 1);
+    TCNT2 = 0;
+    TIFR2 = _BV(OCF2A);
+    TIMSK2 = _BV(OCIE2A);
+    SREG = sreg;
+}
+
+void ControlTick::halt()
+{
+    // One register write: safe from loop() and the watchdog ISR. A tick
+    // the watchdog ISR preempted still finishes, but the motor outputs
+    // are latched off by then (Motor::emergencyStop())
+    TIMSK2 = 0;
+}
+
+void ControlTick::setInputs(int distance, uint16_t supplyMv)
+{
+    // Odd while writing: the ISR keeps its previous copy
+    inSeq++;
+    inDistance = distance;
+    inSupplyMv = supplyMv;
+    inSeq++;
+}
+
+ControlOutputs ControlTick::outputs()
+{
+    ControlOutputs copy;
+    uint8_t before;
+    do
+    {
+        before = outSeq;
+        asm volatile("" ::: "memory");  // copy strictly between the counter reads
+        copy = outBuf;
+        asm volatile("" ::: "memory");
+    } while (before != outSeq || (before & 1));
+    return copy;
+}
+
+void ControlTick::isr()
+{
+    // Timer2 ticks since the compare match = entry latency (64µs units)
+    uint8_t lateTicks = TCNT2;
+    unsigned long startUs = micros();
+
+    // loop() cannot run while we do, so an even counter means a whole write
+    if ((inSeq & 1) == 0)
+    {
+        isrDistance = inDistance;
+        isrSupplyMv = inSupplyMv;
+    }
+
+    unsigned long now = millis();
+    out->setSupplyMillivolts(isrSupplyMv);
+    PROFILE_START(PROF_CONTROL);
+    int speedPct = ctl->step(isrDistance, now);
+    PROFILE_STOP(PROF_CONTROL);
+
+    PROFILE_START(PROF_SET_SPEED);
+    out->setSpeed(speedPct);
+    out->update();
+    PROFILE_STOP(PROF_SET_SPEED);
+
+    uint16_t execUs = (uint16_t)(micros() - startUs);
+    uint16_t latencyUs = (uint16_t)lateTicks * 64;
+
+    outSeq++;
+    asm volatile("" ::: "memory");
+    outBuf.distance = isrDistance;
+    outBuf.speedPct = speedPct;
+    outBuf.mode = ctl->mode();
+    outBuf.target = out->command();
+    outBuf.duty = out->appliedDuty();
+    outBuf.kick = out->kicking();
+    outBuf.execUs = execUs;
+    if (execUs > outBuf.maxExecUs) outBuf.maxExecUs = execUs;
+    if (latencyUs > outBuf.maxLatencyUs) outBuf.maxLatencyUs = latencyUs;
+    outBuf.ticks++;
+    asm volatile("" ::: "memory");
+    outSeq++;
+}
+
+ISR(TIMER2_COMPA_vect, ISR_NOBLOCK)
+{
+    ControlTick::isr();
+}
+
+#endif // CONTROL_TIMER_ISR
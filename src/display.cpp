@@ -12,6 +12,43 @@
  * 
  * Uses U8g2 SSD1306 128x64 hardware I2C driver.
  * 
+ * Full-buffer mode renders once and sends the buffer; page-buffer mode
+ * (DISPLAY_PAGE_BUFFER = 1/2) runs the same render() inside the
+ * firstPage()/nextPage() loop, once per buffered page strip.
+ * 
+ * At 100kHz I2C a full flush is ~90ms, so redrawing unchanged frames
+ * from the 10ms loop capped the whole control rate; unchanged frames are
+ * now skipped entirely.
+ * 
+ * Layers (full-buffer mode): the static layer (title, "Distance:" and
+ * "PWM:" labels, bar outline) is drawn only with a full frame, i.e.
+ * after begin(), a page change or an error view change. Otherwise the
+ * buffer is kept and only the dynamic fields that changed are cleared
+ * (box from label end to the old text end) and redrawn; the bar fills or
+ * erases just the span between old and new length. A typical frame is
+ * one number + unit instead of the whole screen (4 text runs + frame),
+ * roughly a quarter of the glyph decoding.
+ * 
+ * Dirty tiles: only the 8x8 tiles covering the redrawn fields are sent
+ * with updateDisplayArea().
+ * 
+ * Digit sprites (DISPLAY_BLIT_DIGITS): a value field such as "76% FWD"
+ * is 6 sprite copies (~35 bytes memcpy_P, est. ~30µs at 16MHz) instead
+ * of 7 decoded ncenB08 glyphs (est. ~0.4–0.6ms), and its dirty area is
+ * one tile row instead of two. Estimates from cycle counts; on hardware
+ * compare lastRenderUs() ('r' on serial) between DISPLAY_SPRITE_DIGITS=1
+ * and =0 builds.
+ * With DISPLAY_ASYNC_FLUSH the same tiles are queued and streamed from
+ * the TWI interrupt (I2cAsync) after update() returns.
+ * 
+ * Text: labels live in PROGMEM and numbers go through textFormat.h, so
+ * vfprintf is no longer linked (~1.5KB flash). Building a frame's text
+ * (2 numbers) costs ~50µs vs ~1ms+ for three snprintf("%d") calls.
+ * 
+ * Typical frames: bar-only step 16 B, PWM line + bar ≈ 180 B, distance
+ * line ≈ 260 B, instead of 1024 B. lastFlushBytes()/lastFlushUs()
+ * report the per-frame cost.
+ * 
  * @author Michael Garcia, M&E Design
  * @contact michael@mandedesign.studio
  * @website www.mandedesign.studio
@@ -20,84 +57,731 @@
  */
 
 #include "display.h"
+#include "textFormat.h"
+#include <string.h>
+#if DISPLAY_BLIT_DIGITS
+#include "displaySprites.h"
+#endif
+
+#if !DISPLAY_USE_U8X8
+
+// U8g2 back end only: displayU8x8.cpp includes it in U8x8 builds
+#include "displayStrings.h"
+
+#if DISPLAY_ASYNC_FLUSH
+
+Display* Display::streamOwner = nullptr;
+
+namespace
+{
+    // u8x8 byte transfer buffer (init / commands, sent blocking; longer
+    // transfers go out in several transactions)
+    uint8_t txBuf[32];
+    uint8_t txLen = 0;
+}
+
+Display::Display()
+{
+    // Same controller setup as the _F_HW_I2C class, but bytes go through
+    // I2cAsync instead of Wire
+    u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2.getU8g2(), U8G2_R0,
+                                           Display::i2cByte,
+                                           u8x8_gpio_and_delay_arduino);
+}
+
+uint8_t Display::i2cByte(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr)
+{
+    switch (msg)
+    {
+        case U8X8_MSG_BYTE_INIT:
+            I2cAsync::begin(I2C_CLOCK_HZ);
+            break;
+
+        case U8X8_MSG_BYTE_SET_DC:
+            break;
+
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            txLen = 0;
+            break;
+
+        case U8X8_MSG_BYTE_SEND:
+        {
+            const uint8_t* data = (const uint8_t*)argPtr;
+            while (argInt-- > 0)
+            {
+                if (txLen == sizeof(txBuf))
+                {
+                    // Full: send this part, continue in a new transaction
+                    // that repeats the SSD1306 control byte (txBuf[0])
+                    I2cAsync::writeBlocking(u8x8_GetI2CAddress(u8x8) >> 1, txBuf, txLen);
+                    txLen = 1;
+                }
+                txBuf[txLen++] = *data++;
+            }
+            break;
+        }
+
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            I2cAsync::writeBlocking(u8x8_GetI2CAddress(u8x8) >> 1, txBuf, txLen);
+            break;
+
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+void Display::queueTiles(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+    if (dirtyCount >= MAX_DIRTY)
+    {
+        // Out of slots: send the whole frame instead
+        dirty[0] = { 0, 0, 16, 8 };
+        dirtyCount = 1;
+        return;
+    }
+    dirty[dirtyCount++] = { tx, ty, tw, th };
+}
+
+void Display::startStream()
+{
+    if (dirtyCount == 0)
+        return;
+
+    streamRect = 0;
+    streamRow = 0;
+    streamCmdSent = false;
+    streamOwner = this;
+    I2cAsync::start(u8x8_GetI2CAddress(u8g2.getU8x8()) >> 1, Display::nextSegment);
+}
+
+bool Display::nextSegment(I2cSegment& seg)
+{
+    // Interrupt context: emit (position command, tile data) per tile row
+    Display* d = streamOwner;
+
+    if (d->streamRect >= d->dirtyCount)
+    {
+        d->dirtyCount = 0;
+        return false;
+    }
+
+    const TileRect& r = d->dirty[d->streamRect];
+    uint8_t page = r.ty + d->streamRow;
+    uint8_t col = r.tx * 8;
+
+    if (!d->streamCmdSent)
+    {
+        // Page addressing: page, column low nibble, column high nibble
+        d->streamCmd[0] = 0xB0 | page;
+        d->streamCmd[1] = 0x00 | (col & 0x0F);
+        d->streamCmd[2] = 0x10 | (col >> 4);
+        seg.data = d->streamCmd;
+        seg.len = 3;
+        seg.control = 0x00;     // command stream
+        seg.useControl = true;
+        d->streamCmdSent = true;
+        return true;
+    }
+
+    seg.data = d->u8g2.getBufferPtr() + (uint16_t)page * 128 + col;
+    seg.len = r.tw * 8;
+    seg.control = 0x40;         // data stream
+    seg.useControl = true;
+    d->streamCmdSent = false;
+
+    if (++d->streamRow >= r.th)
+    {
+        d->streamRow = 0;
+        d->streamRect++;
+    }
+    return true;
+}
+
+bool Display::busy() const
+{
+    return I2cAsync::busy();
+}
+
+#else
 
 Display::Display()
     : u8g2(U8G2_R0, U8X8_PIN_NONE)   // rotation, reset pin (none)
 {
 }
 
+bool Display::busy() const
+{
+    return false;
+}
+
+#endif
+
 void Display::begin()
 {
     u8g2.begin();
     u8g2.setFont(u8g2_font_ncenB08_tr);
 
+#if DISPLAY_ASYNC_FLUSH
+    // Async stream positions tiles with page-addressing commands
+    static const uint8_t PAGE_MODE[] = { 0x00, 0x20, 0x02 };
+    I2cAsync::writeBlocking(u8x8_GetI2CAddress(u8g2.getU8x8()) >> 1, PAGE_MODE, sizeof(PAGE_MODE));
+#endif
+
     // Optional splash / clear
+    char title[24];
+    char status[24];
+    appendP(title, STR_TITLE);
+    appendP(status, STR_INIT);
+
+#if DISPLAY_PAGE_BUFFER
+    u8g2.firstPage();
+    do
+    {
+        u8g2.drawStr(0, 10, title);
+        u8g2.drawStr(0, 24, status);
+    } while (u8g2.nextPage());
+#else
     u8g2.clearBuffer();
-    u8g2.drawStr(0, 10, "Motor Control");
-    u8g2.drawStr(0, 24, "System Initializing...");
+    u8g2.drawStr(0, 10, title);
+    u8g2.drawStr(0, 24, status);
     u8g2.sendBuffer();
+#endif
+
+    frameValid = false;   // splash on screen, next update() must draw
 }
 
-void Display::update(int distance, int pwmPercent, bool error)
+void Display::update(const Telemetry& t)
 {
-    u8g2.clearBuffer();
+#if DISPLAY_ASYNC_FLUSH
+    // Previous frame still streaming from the buffer: try again next call
+    if (I2cAsync::busy())
+        return;
 
-    // Title
-    u8g2.setFont(u8g2_font_ncenB08_tr);
-    u8g2.drawStr(0, 10, "Motor Control");
+    // A NACK / bus error aborted a transfer: drop the stale tile list
+    // and redraw the whole frame, since the lost tiles are unknown
+    uint16_t errors = I2cAsync::errors();
+    if (errors != streamErrors)
+    {
+        streamErrors = errors;
+        dirtyCount = 0;
+        frameValid = false;
+    }
+#endif
 
-    if (error)
+    switch (currentPage)
     {
-        // Error view
-        u8g2.drawStr(0, 30, "ERROR: Timeout");
+        case PAGE_MAIN:  updateMain(t.distance, t.speedPct, t.error); break;
+        case PAGE_GRAPH: updateGraph(); break;
+        default:         updateDiag(t); break;
+    }
+}
+
+void Display::updateMain(int distance, int pwmPercent, bool error)
+{
+    // All non-positive distances render as "No Obstruction"
+    if (!error && distance < 0)
+        distance = 0;
+
+    // Nothing visible changed: skip render and the I2C flush
+    if (frameValid && distance == shownDistance &&
+        pwmPercent == shownPwm && error == shownError)
+    {
+        return;
+    }
+
+    unsigned long startUs = micros();
 
-        // amazonq-ignore-next-line
-        char errStr[32];
-        snprintf(errStr, sizeof(errStr), "Raw: %d cm", distance);
-        u8g2.drawStr(0, 42, errStr);
+#if DISPLAY_PAGE_BUFFER
+    frameValid = true;
+    shownDistance = distance;
+    shownPwm = pwmPercent;
+    shownError = error;
+
+    // Low-RAM: render each page strip and send it before the next
+    u8g2.firstPage();
+    do
+    {
+        render(distance, pwmPercent, error);
+    } while (u8g2.nextPage());
+    flushBytes = FRAME_BYTES;
+    renderUs = 0;   // interleaved with the flush, not separable
+#else
+    // Previous frame geometry, for dirty-tile tracking
+    bool fullFlush = !frameValid || error || (error != shownError);
+    bool distChanged = (distance != shownDistance);
+    bool pwmChanged = (pwmPercent != shownPwm);
+    uint8_t prevDistWidth = distWidth;
+    uint8_t prevPwmWidth = pwmWidth;
+    uint8_t prevBar = barWidth(shownPwm);
 
-        u8g2.drawStr(0, 54, "Check sensor/wiring");
+    bool distLabelChanged = (distance <= 0) != (shownDistance <= 0);
+
+    frameValid = true;
+    shownDistance = distance;
+    shownPwm = pwmPercent;
+    shownError = error;
+
+    if (fullFlush)
+    {
+        // Static + dynamic layer from scratch (after begin / page or view change)
+        u8g2.clearBuffer();
+        render(distance, pwmPercent, error);
+        renderUs = elapsedUs(startUs);
+#if DISPLAY_ASYNC_FLUSH
+        queueTiles(0, 0, 16, 8);
+#else
+        u8g2.sendBuffer();
+#endif
+        flushBytes = FRAME_BYTES;
     }
     else
     {
-        // Distance line
-        char distStr[32];
-        if (distance <= 0)
+        // Dynamic layer only: clear and redraw the changed fields in place,
+        // then send the tiles covering them. All drawing comes first so
+        // renderUs excludes the (blocking, non-async) flushes.
+        flushBytes = 0;
+        uint8_t barLo = 0;
+        uint8_t barHi = 0;
+        if (distChanged)
         {
-            // amazonq-ignore-next-line
-            snprintf(distStr, sizeof(distStr), "No Obstruction");
+            // Label stays unless switching to / from "No Obstruction"
+            if (distLabelChanged)
+                clearField(0, DIST_BASELINE, prevDistWidth);
+            else
+                clearField(distLabelWidth, DIST_BASELINE, prevDistWidth);
+            drawDistance(distance, distLabelChanged);
         }
-        else
+        if (pwmChanged)
+        {
+            clearField(pwmLabelWidth, PWM_BASELINE, prevPwmWidth);
+            drawPwm(pwmPercent);
+
+            // Bar: fill or erase only the span between old and new length
+            uint8_t bar = barWidth(pwmPercent);
+            barLo = min(prevBar, bar);
+            barHi = max(prevBar, bar);
+            if (barHi > barLo)
+            {
+                u8g2.setDrawColor(bar > prevBar ? 1 : 0);
+                u8g2.drawBox(BAR_X + barLo, BAR_Y, barHi - barLo, BAR_H);
+                u8g2.setDrawColor(1);
+            }
+        }
+        renderUs = elapsedUs(startUs);
+
+        if (distChanged)
+        {
+            if (distLabelChanged)
+                flushArea(0, DIST_BASELINE - TEXT_ASCENT, max(prevDistWidth, distWidth), TEXT_HEIGHT);
+            else
+                flushField(distLabelWidth, DIST_BASELINE, max(prevDistWidth, distWidth));
+        }
+        if (pwmChanged)
+        {
+            flushField(pwmLabelWidth, PWM_BASELINE, max(prevPwmWidth, pwmWidth));
+            flushArea(BAR_X + barLo, BAR_Y, barHi - barLo, BAR_H);
+        }
+    }
+
+#if DISPLAY_ASYNC_FLUSH
+    startStream();
+#endif
+#endif
+
+    flushUs = elapsedUs(startUs);
+}
+
+void Display::updateDiag(const Telemetry& t)
+{
+    char lines[DIAG_LINES][24];
+    uint8_t changed = 0;
+
+    // Build the page text; a line is redrawn only if its text changed
+    for (uint8_t i = 0; i < DIAG_LINES; i++)
+    {
+        formatDiagLine(lines[i], currentPage, i, t);
+
+        // Compare the real text (formatDiagLine() keeps it to DIAG_COLS)
+        if (!frameValid || strcmp(lines[i], shownDiag[i]) != 0)
+        {
+            changed |= (uint8_t)(1 << i);
+            strcpy(shownDiag[i], lines[i]);
+        }
+    }
+
+    if (changed == 0)
+        return;
+
+    unsigned long startUs = micros();
+
+#if DISPLAY_PAGE_BUFFER
+    u8g2.firstPage();
+    do
+    {
+        drawTitle(diagTitle(currentPage));
+        for (uint8_t i = 0; i < DIAG_LINES; i++)
+            u8g2.drawStr(0, DIAG_BASELINE + i * TEXT_HEIGHT, lines[i]);
+    } while (u8g2.nextPage());
+    flushBytes = FRAME_BYTES;
+#else
+    if (!frameValid)
+    {
+        u8g2.clearBuffer();
+        drawTitle(diagTitle(currentPage));
+        for (uint8_t i = 0; i < DIAG_LINES; i++)
+            u8g2.drawStr(0, DIAG_BASELINE + i * TEXT_HEIGHT, lines[i]);
+#if DISPLAY_ASYNC_FLUSH
+        queueTiles(0, 0, 16, 8);
+#else
+        u8g2.sendBuffer();
+#endif
+        flushBytes = FRAME_BYTES;
+    }
+    else
+    {
+        // Clear, redraw and flush only the changed lines
+        flushBytes = 0;
+        for (uint8_t i = 0; i < DIAG_LINES; i++)
+        {
+            if (!(changed & (1 << i)))
+                continue;
+
+            uint8_t top = DIAG_BASELINE + i * TEXT_HEIGHT - TEXT_ASCENT;
+            u8g2.setDrawColor(0);
+            u8g2.drawBox(0, top, 128, TEXT_HEIGHT);
+            u8g2.setDrawColor(1);
+            u8g2.drawStr(0, DIAG_BASELINE + i * TEXT_HEIGHT, lines[i]);
+            flushArea(0, top, 128, TEXT_HEIGHT);
+        }
+    }
+
+#if DISPLAY_ASYNC_FLUSH
+    startStream();
+#endif
+#endif
+
+    frameValid = true;
+    flushUs = elapsedUs(startUs);
+}
+
+void Display::drawTitle(const char* progmemStr)
+{
+    char line[24];
+    appendP(line, progmemStr);
+    u8g2.setFont(u8g2_font_ncenB08_tr);
+    u8g2.drawStr(0, 10, line);
+}
+
+void Display::addSample(int distance, int speedPct)
+{
+    if (++decimCount < HISTORY_DECIMATION)
+        return;
+    decimCount = 0;
+
+    HistorySample& s = history[sampleSeq % HISTORY_LEN];
+    s.distance = (distance <= 0 || distance > 254) ? 255 : (uint8_t)distance;
+    s.speed = (int8_t)constrain(speedPct, -100, 100);
+
+    if (++sampleSeq % HISTORY_LEN == 0)
+        historyFull = true;
+}
+
+void Display::updateGraph()
+{
+    if (frameValid && plottedSeq == sampleSeq)
+        return;
+
+    unsigned long startUs = micros();
+
+#if DISPLAY_PAGE_BUFFER
+    // No persistent buffer: redraw the whole plot page by page
+    u8g2.firstPage();
+    do
+    {
+        renderGraph();
+    } while (u8g2.nextPage());
+    plottedSeq = sampleSeq;
+    flushBytes = FRAME_BYTES;
+#else
+    if (!frameValid)
+    {
+        u8g2.clearBuffer();
+        renderGraph();
+        plottedSeq = sampleSeq;
+#if DISPLAY_ASYNC_FLUSH
+        queueTiles(0, 0, 16, 8);
+#else
+        u8g2.sendBuffer();
+#endif
+        flushBytes = FRAME_BYTES;
+    }
+    else
+    {
+        // Only the newly exposed columns (at most a full sweep)
+        uint16_t pending = sampleSeq - plottedSeq;
+        if (pending > HISTORY_LEN)
+        {
+            plottedSeq = sampleSeq - HISTORY_LEN;
+            pending = HISTORY_LEN;
+        }
+
+        uint8_t first = plottedSeq % HISTORY_LEN;
+        while (plottedSeq != sampleSeq)
         {
-            snprintf(distStr, sizeof(distStr), "Distance: %d cm", distance);
+            drawColumn(plottedSeq++, true);
         }
-        u8g2.drawStr(0, 30, distStr);
 
-        // PWM + direction line
-        char pwmStr[32];
-        if (pwmPercent < 0)
+        // New columns + erase-ahead gap, split where the sweep wraps
+        flushBytes = 0;
+        uint8_t span = (pending >= HISTORY_LEN) ? HISTORY_LEN : (uint8_t)(pending + 1);
+        if (first + span <= HISTORY_LEN)
         {
-            snprintf(pwmStr, sizeof(pwmStr), "PWM: %d%% REV", -pwmPercent);
+            flushArea(first, PLOT_Y, span, PLOT_H);
         }
         else
         {
-            snprintf(pwmStr, sizeof(pwmStr), "PWM: %d%% FWD", pwmPercent);
+            flushArea(first, PLOT_Y, HISTORY_LEN - first, PLOT_H);
+            flushArea(0, PLOT_Y, first + span - HISTORY_LEN, PLOT_H);
         }
-        u8g2.drawStr(0, 42, pwmStr);
+    }
+
+#if DISPLAY_ASYNC_FLUSH
+    startStream();
+#endif
+#endif
+
+    frameValid = true;
+    flushUs = elapsedUs(startUs);
+}
+
+void Display::renderGraph()
+{
+    drawTitle(STR_HISTORY);
+
+    uint16_t count = historyFull ? HISTORY_LEN : sampleSeq;
+    for (uint16_t i = count; i > 0; i--)
+    {
+        // Oldest column has no on-screen predecessor
+        drawColumn(sampleSeq - i, i != count);
+    }
+}
+
+void Display::drawColumn(uint16_t seq, bool connect)
+{
+    uint8_t x = seq % HISTORY_LEN;      // ring index == screen column
+    uint8_t gap = (x + 1) % HISTORY_LEN;
 
-        // Status bar (abs magnitude, 0–100%)
-        int mag = abs(pwmPercent);
-        if (mag > 100) mag = 100;
+    // Clear this column and the erase-ahead gap
+    u8g2.setDrawColor(0);
+    u8g2.drawVLine(x, PLOT_Y, PLOT_H);
+    u8g2.drawVLine(gap, PLOT_Y, PLOT_H);
+    u8g2.setDrawColor(1);
+
+    // Dotted zero-speed reference
+    if ((x & 3) == 0)
+        u8g2.drawPixel(x, speedY(0));
+
+    const HistorySample& cur = history[x];
+    uint8_t dy = distY(cur.distance);
+    uint8_t sy = speedY(cur.speed);
+
+    // Connect to the previous column so steps read as lines
+    uint8_t pdy = dy;
+    uint8_t psy = sy;
+    if (connect && x > 0)
+    {
+        const HistorySample& prev = history[x - 1];
+        pdy = distY(prev.distance);
+        psy = speedY(prev.speed);
+    }
+    u8g2.drawVLine(x, min(dy, pdy), abs((int)dy - (int)pdy) + 1);
+    u8g2.drawVLine(x, min(sy, psy), abs((int)sy - (int)psy) + 1);
+}
+
+uint8_t Display::distY(uint8_t cm)
+{
+    // 0 cm at the bottom, PLOT_MAX_CM and beyond at the top
+    if (cm > PLOT_MAX_CM) cm = PLOT_MAX_CM;
+    return PLOT_Y + PLOT_H - 1 - (uint8_t)(((uint16_t)cm * (PLOT_H - 1)) / PLOT_MAX_CM);
+}
+
+uint8_t Display::speedY(int8_t pct)
+{
+    // +100% at the top, -100% at the bottom, 0 in the middle
+    int16_t half = (PLOT_H - 1) / 2;
+    return (uint8_t)(PLOT_Y + half - ((int16_t)pct * half) / 100);
+}
+
+void Display::flushArea(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+    if (w == 0 || h == 0)
+        return;
 
+    // Pixel rectangle → covering 8x8 tile rectangle
+    uint8_t tx = x / 8;
+    uint8_t ty = y / 8;
+    uint8_t tw = (uint8_t)((x + w + 7) / 8) - tx;
+    uint8_t th = (uint8_t)((y + h + 7) / 8) - ty;
+
+#if DISPLAY_ASYNC_FLUSH
+    queueTiles(tx, ty, tw, th);
+#else
+    u8g2.updateDisplayArea(tx, ty, tw, th);
+#endif
+    flushBytes += (uint16_t)tw * th * 8;
+}
+
+void Display::render(int distance, int pwmPercent, bool error)
+{
+    char line[24];
+    char* p;
+
+    // Static layer: title
+    u8g2.setFont(u8g2_font_ncenB08_tr);
+    appendP(line, STR_TITLE);
+    u8g2.drawStr(0, 10, line);
+
+    if (error)
+    {
+        // Error view
+        appendP(line, STR_ERR_TIMEOUT);
+        u8g2.drawStr(0, 30, line);
+
+        p = appendP(line, STR_RAW);
+        p = formatInt(p, distance);
+        appendP(p, STR_CM);
+        u8g2.drawStr(0, 42, line);
+
+        appendP(line, STR_ERR_HINT);
+        u8g2.drawStr(0, 54, line);
+    }
+    else
+    {
+        // Static layer: PWM label and bar outline
+        appendP(line, STR_PWM);
+        pwmLabelWidth = u8g2.drawStr(0, PWM_BASELINE, line);
         u8g2.drawFrame(0, 50, 128, 10);
 
-        if (mag > 0)
+        // Dynamic layer
+        drawDistance(distance, true);
+        drawPwm(pwmPercent);
+
+        uint8_t bar = barWidth(pwmPercent);
+        if (bar > 0)
         {
-            // Map 0–100% to 0–124px inside the frame
-            int barWidth = (mag * 124) / 100;
-            u8g2.drawBox(2, 52, barWidth, 6);
+            u8g2.drawBox(BAR_X, BAR_Y, bar, BAR_H);
         }
     }
+}
 
-    u8g2.sendBuffer();
+void Display::drawDistance(int distance, bool withLabel)
+{
+    char line[24];
+
+    if (distance <= 0)
+    {
+        appendP(line, STR_NO_OBSTRUCTION);
+        distWidth = u8g2.drawStr(0, DIST_BASELINE, line);
+        return;
+    }
+
+    if (withLabel)
+    {
+        appendP(line, STR_DISTANCE);
+        distLabelWidth = u8g2.drawStr(0, DIST_BASELINE, line);
+    }
+
+#if DISPLAY_BLIT_DIGITS
+    uint8_t x = blitUInt(distLabelWidth, DIST_PAGE, (uint16_t)distance);
+    distWidth = blit(x + SPRITE_SPACE_W, DIST_PAGE, SPRITE_CM, sizeof(SPRITE_CM));
+#else
+    char* p = formatInt(line, distance);
+    appendP(p, STR_CM);
+    distWidth = distLabelWidth + u8g2.drawStr(distLabelWidth, DIST_BASELINE, line);
+#endif
+}
+
+void Display::drawPwm(int pwmPercent)
+{
+#if DISPLAY_BLIT_DIGITS
+    uint8_t x = blitUInt(pwmLabelWidth, PWM_PAGE, (uint16_t)abs(pwmPercent));
+    x = blit(x, PWM_PAGE, SPRITE_PCT, sizeof(SPRITE_PCT));
+    if (pwmPercent < 0)
+        pwmWidth = blit(x + SPRITE_SPACE_W, PWM_PAGE, SPRITE_REV, sizeof(SPRITE_REV));
+    else
+        pwmWidth = blit(x + SPRITE_SPACE_W, PWM_PAGE, SPRITE_FWD, sizeof(SPRITE_FWD));
+#else
+    char line[24];
+    char* p = formatInt(line, abs(pwmPercent));
+    appendP(p, (pwmPercent < 0) ? STR_PCT_REV : STR_PCT_FWD);
+    pwmWidth = pwmLabelWidth + u8g2.drawStr(pwmLabelWidth, PWM_BASELINE, line);
+#endif
+}
+
+void Display::flushField(uint8_t x, uint8_t baseline, uint8_t right)
+{
+    if (right <= x)
+        return;
+
+#if DISPLAY_BLIT_DIGITS
+    // Sprites live in a single page; the text box above/below is unchanged
+    flushArea(x, ((baseline - 6) / 8) * 8, right - x, 8);
+#else
+    flushArea(x, baseline - TEXT_ASCENT, right - x, TEXT_HEIGHT);
+#endif
+}
+
+#if DISPLAY_BLIT_DIGITS
+uint8_t Display::blit(uint8_t x, uint8_t page, const uint8_t* sprite, uint8_t width)
+{
+    if (x >= 128)
+        return x;
+    if (width > 128 - x)
+        width = 128 - x;
+
+    uint8_t* dst = u8g2.getBufferPtr() + (uint16_t)page * 128 + x;
+    memcpy_P(dst, sprite, width);
+    x += width;
+
+    // Letter gap
+    if (x < 128)
+    {
+        dst[width] = 0;
+        x++;
+    }
+    return x;
+}
+
+uint8_t Display::blitUInt(uint8_t x, uint8_t page, uint16_t value)
+{
+    char digits[6];
+    char* end = formatUInt(digits, value);
+
+    for (const char* d = digits; d < end; d++)
+    {
+        x = blit(x, page, SPRITE_DIGITS[*d - '0'], SPRITE_GLYPH_W);
+    }
+    return x;
+}
+#endif
+
+void Display::clearField(uint8_t x, uint8_t baseline, uint8_t right)
+{
+    if (right <= x)
+        return;
+
+    u8g2.setDrawColor(0);
+    u8g2.drawBox(x, baseline - TEXT_ASCENT, right - x, TEXT_HEIGHT);
+    u8g2.setDrawColor(1);
+}
+
+#endif // !DISPLAY_USE_U8X8
+
+uint8_t Display::barWidth(int pwmPercent)
+{
+    // Map 0–100% magnitude to 0–124px inside the frame
+    int mag = abs(pwmPercent);
+    if (mag > 100) mag = 100;
+    return (uint8_t)((mag * BAR_MAX_W) / 100);
 }
@@ -0,0 +1,181 @@
+/**
+ * @file displayPages.cpp
+ * @brief Page selection and diagnostic page text, shared by the Display back ends
+ * @version 1.0.0
+ *
+ * Diagnostic pages are four short text lines (at most DIAG_COLS chars,
+ * so they fit the 16-column U8x8 grid as well) built from the Telemetry
+ * snapshot. Each back end only decides how to put changed lines on the
+ * panel.
+ *
+ *     Loop timing   : Min / Avg / Max tick (µs), overruns + reset cause
+ *     Sensor health : readings, timeouts, out-of-range, histogram (%)
+ *     Motor state   : maneuver mode, target %, applied duty, supply
+ *
+ * Labels are sized so the worst case of every line fits in 16 columns
+ * (widths noted per line below); the final cut is only a guard.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "display.h"
+#include "textFormat.h"
+
+static const char PG_LOOP[]      PROGMEM = "Loop Timing";
+static const char PG_SENSOR[]    PROGMEM = "Sensor Health";
+static const char PG_MOTOR[]     PROGMEM = "Motor State";
+
+static const char LBL_MIN[]      PROGMEM = "Min  ";
+static const char LBL_AVG[]      PROGMEM = "Avg  ";
+static const char LBL_MAX[]      PROGMEM = "Max  ";
+static const char LBL_US[]       PROGMEM = " us";
+static const char LBL_OVERRUN[]  PROGMEM = "Ovr ";
+static const char LBL_READS[]    PROGMEM = "Reads   ";
+static const char LBL_TIMEOUT[]  PROGMEM = "Timeout ";
+static const char LBL_RANGE[]    PROGMEM = "Range   ";
+static const char LBL_HIST[]     PROGMEM = "H";
+static const char LBL_MODE[]     PROGMEM = "Mode ";
+static const char LBL_TARGET[]   PROGMEM = "Target ";
+static const char LBL_DUTY[]     PROGMEM = "Duty ";
+static const char LBL_KICK[]     PROGMEM = " KICK";
+static const char LBL_SUPPLY[]   PROGMEM = "Supply ";
+static const char LBL_MV[]       PROGMEM = "mV";
+
+static const char MODE_NORMAL_STR[]   PROGMEM = "NORMAL";
+static const char MODE_STOPPING_STR[] PROGMEM = "STOP";
+static const char MODE_REVERSE_STR[]  PROGMEM = "REVERSE";
+static const char MODE_SLOW_STR[]     PROGMEM = "SLOW FWD";
+
+uint16_t Display::elapsedUs(unsigned long startUs)
+{
+    unsigned long us = micros() - startUs;
+    return (us > 0xFFFF) ? 0xFFFF : (uint16_t)us;
+}
+
+bool Display::pageAvailable(Page page)
+{
+#if DISPLAY_USE_U8X8
+    // No frame buffer for the history plot
+    if (page == PAGE_GRAPH)
+        return false;
+#endif
+    return page < PAGE_COUNT;
+}
+
+void Display::setPage(Page page)
+{
+    if (page == currentPage || !pageAvailable(page))
+        return;
+
+    // Only marks the page; the redraw happens in the next update()
+    currentPage = page;
+    frameValid = false;
+}
+
+void Display::nextPage()
+{
+    uint8_t next = currentPage;
+    do
+    {
+        next = (next + 1) % PAGE_COUNT;
+    } while (!pageAvailable((Page)next));
+
+    setPage((Page)next);
+}
+
+const char* Display::diagTitle(Page page)
+{
+    switch (page)
+    {
+        case PAGE_LOOP:   return PG_LOOP;
+        case PAGE_SENSOR: return PG_SENSOR;
+        default:          return PG_MOTOR;
+    }
+}
+
+char* Display::formatDiagLine(char* line, Page page, uint8_t index, const Telemetry& t)
+{
+    char* p = line;
+
+    if (page == PAGE_LOOP)
+    {
+        switch (index)
+        {
+            // "Min  65535 us" (and Avg / Max): 13
+            case 0: p = formatUInt(appendP(p, LBL_MIN), t.tickMinUs, 5); p = appendP(p, LBL_US); break;
+            case 1: p = formatUInt(appendP(p, LBL_AVG), t.tickAvgUs, 5); p = appendP(p, LBL_US); break;
+            case 2: p = formatUInt(appendP(p, LBL_MAX), t.tickMaxUs, 5); p = appendP(p, LBL_US); break;
+            default:
+                // "Ovr 65535 WDT": 13
+                p = formatUInt(appendP(p, LBL_OVERRUN), t.overruns);
+                if (t.resetReason)
+                {
+                    *p++ = ' ';
+                    p = appendP(p, t.resetReason);
+                }
+                break;
+        }
+    }
+    else if (page == PAGE_SENSOR)
+    {
+        switch (index)
+        {
+            // "Reads   65535" (and Timeout / Range): 13
+            case 0: p = formatUInt(appendP(p, LBL_READS), t.sensor.readings); break;
+            case 1: p = formatUInt(appendP(p, LBL_TIMEOUT), t.sensor.timeouts); break;
+            case 2: p = formatUInt(appendP(p, LBL_RANGE), t.sensor.outOfRange); break;
+            default:
+            {
+                // Share of valid readings per bin: <20, <60, <150, >=150 cm.
+                // Shares add up to at most 100, so at most 8 digits:
+                // "H 25 25 25 25": 13
+                uint32_t valid = 0;
+                for (uint8_t i = 0; i < UltraSonic::HIST_BINS; i++)
+                    valid += t.sensor.bins[i];
+
+                p = appendP(p, LBL_HIST);
+                for (uint8_t i = 0; i < UltraSonic::HIST_BINS; i++)
+                {
+                    uint16_t pct = valid ? (uint16_t)((t.sensor.bins[i] * 100UL) / valid) : 0;
+                    *p++ = ' ';
+                    p = formatUInt(p, pct);
+                }
+                break;
+            }
+        }
+    }
+    else
+    {
+        switch (index)
+        {
+            // "Mode SLOW FWD": 13, "Target -100%": 12,
+            // "Duty -255 KICK": 14, "Supply 65535mV": 14
+            case 0:
+            {
+                static const char* const MODE_NAMES[MANEUVER_STATE_COUNT] = {
+                    MODE_NORMAL_STR, MODE_STOPPING_STR, MODE_REVERSE_STR, MODE_SLOW_STR
+                };
+                p = appendP(p, LBL_MODE);
+                p = appendP(p, MODE_NAMES[t.mode < MANEUVER_STATE_COUNT ? t.mode : 0]);
+                break;
+            }
+            case 1: p = formatInt(appendP(p, LBL_TARGET), t.target); *p++ = '%'; *p = '\0'; break;
+            case 2:
+                p = formatInt(appendP(p, LBL_DUTY), t.duty);
+                if (t.kick)
+                    p = appendP(p, LBL_KICK);
+                break;
+            default: p = formatUInt(appendP(p, LBL_SUPPLY), t.supplyMv); p = appendP(p, LBL_MV); break;
+        }
+    }
+
+    // Keep within the narrowest (U8x8) grid
+    if (p > line + DIAG_COLS)
+    {
+        p = line + DIAG_COLS;
+        *p = '\0';
+    }
+    return p;
+}
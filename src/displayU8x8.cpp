@@ -0,0 +1,264 @@
+/**
+ * @file displayU8x8.cpp
+ * @brief Text-only OLED back end (U8x8, no frame buffer)
+ * @version 1.0.0
+ * 
+ * Selected with DISPLAY_USE_U8X8=1 for headless / cost-down units.
+ * Same Display interface and screen content as the U8g2 back end, laid
+ * out on the 16x8 character grid:
+ * 
+ *     row 0 : Motor Control
+ *     row 3 : Distance: 45 cm   | ERROR: Timeout
+ *     row 5 : PWM: 76% FWD      | Raw: 0 cm
+ *     row 7 : [bar tiles]       | Check sensor
+ * 
+ * Diagnostic pages use rows 2-5 under the page title; the history plot
+ * page needs a frame buffer and is not available here.
+ * 
+ * RAM: no frame buffer; ~72 bytes of row/bar cache.
+ * Cost: each changed character is one 8-byte tile (~0.2ms at 400kHz),
+ * so a typical digit change updates its line in well under 1ms.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "display.h"
+
+#if DISPLAY_USE_U8X8
+
+#include "textFormat.h"
+#include "displayStrings.h"
+
+// Bar tile column patterns (bit 0 = top row of the tile)
+static const uint8_t BAR_EDGE  = 0x7E;   // left/right end of the frame
+static const uint8_t BAR_EMPTY = 0x42;   // frame top + bottom line
+static const uint8_t BAR_FILL  = 0x7E;   // frame + fill rows 2..5
+
+Display::Display()
+    : u8x8(U8X8_PIN_NONE)   // reset pin (none)
+{
+}
+
+bool Display::busy() const
+{
+    return false;
+}
+
+void Display::addSample(int distance, int speedPct)
+{
+    // No history plot on this back end
+    (void)distance;
+    (void)speedPct;
+}
+
+void Display::begin()
+{
+    u8x8.begin();
+    u8x8.setFont(u8x8_font_chroma48medium8_r);
+    resetScreen();
+
+    char line[COLS + 1];
+    appendP(line, STR_INIT_SHORT);
+    u8x8.drawString(0, ROW_DIST, line);
+
+    frameValid = false;   // splash on screen, next update() must draw
+}
+
+void Display::resetScreen()
+{
+    u8x8.clearDisplay();
+
+    char line[COLS + 1];
+    appendP(line, (currentPage == PAGE_MAIN) ? STR_TITLE : diagTitle(currentPage));
+    u8x8.drawString(0, ROW_TITLE, line);
+
+    for (uint8_t i = 0; i < TEXT_ROWS; i++)
+    {
+        memset(shownText[i], ' ', COLS);
+        shownText[i][COLS] = '\0';
+    }
+    barValid = false;
+}
+
+/// @brief Pad a row with spaces to the full grid width
+static void padRow(char* line, char* end, uint8_t cols)
+{
+    while (end < line + cols)
+        *end++ = ' ';
+    *end = '\0';
+}
+
+void Display::update(const Telemetry& t)
+{
+    if (currentPage == PAGE_MAIN)
+        updateMain(t.distance, t.speedPct, t.error);
+    else
+        updateDiag(t);
+}
+
+void Display::updateDiag(const Telemetry& t)
+{
+    unsigned long startUs = micros();
+    flushBytes = 0;
+
+    if (!frameValid)
+    {
+        resetScreen();
+        frameValid = true;
+    }
+
+    // drawRow() diffs against the row cache, so unchanged lines cost nothing
+    for (uint8_t i = 0; i < DIAG_LINES; i++)
+    {
+        char line[24];
+        char* p = formatDiagLine(line, currentPage, i, t);
+        padRow(line, p, COLS);
+        drawRow(ROW_DIAG + i, shownText[i], line);
+    }
+
+    if (flushBytes != 0)
+        flushUs = elapsedUs(startUs);
+}
+
+void Display::updateMain(int distance, int pwmPercent, bool error)
+{
+    // All non-positive distances render as "No Obstruction"
+    if (!error && distance < 0)
+        distance = 0;
+
+    // Nothing visible changed: skip entirely
+    if (frameValid && distance == shownDistance &&
+        pwmPercent == shownPwm && error == shownError)
+    {
+        return;
+    }
+
+    unsigned long startUs = micros();
+    flushBytes = 0;
+
+    // View change (or splash on screen): start from a clean panel
+    if (!frameValid || error != shownError)
+    {
+        resetScreen();
+    }
+
+    frameValid = true;
+    shownDistance = distance;
+    shownPwm = pwmPercent;
+    shownError = error;
+
+    char line[24];
+    char* p;
+
+    if (error)
+    {
+        p = appendP(line, STR_ERR_TIMEOUT);
+        padRow(line, p, COLS);
+        drawRow(ROW_DIST, shownText[0], line);
+
+        p = appendP(line, STR_RAW);
+        p = formatInt(p, distance);
+        p = appendP(p, STR_CM);
+        padRow(line, p, COLS);
+        drawRow(ROW_PWM, shownText[1], line);
+
+        p = appendP(line, STR_ERR_HINT_SHORT);
+        padRow(line, p, COLS);
+        drawRow(ROW_BAR, shownText[2], line);
+    }
+    else
+    {
+        if (distance <= 0)
+        {
+            p = appendP(line, STR_NO_OBSTRUCTION);
+        }
+        else
+        {
+            p = appendP(line, STR_DISTANCE);
+            p = formatInt(p, distance);
+            p = appendP(p, STR_CM);
+        }
+        padRow(line, p, COLS);
+        drawRow(ROW_DIST, shownText[0], line);
+
+        p = appendP(line, STR_PWM);
+        p = formatInt(p, abs(pwmPercent));
+        p = appendP(p, (pwmPercent < 0) ? STR_PCT_REV : STR_PCT_FWD);
+        padRow(line, p, COLS);
+        drawRow(ROW_PWM, shownText[1], line);
+
+        drawBar(barWidth(pwmPercent));
+    }
+
+    flushUs = elapsedUs(startUs);
+}
+
+void Display::drawRow(uint8_t row, char* cache, const char* text)
+{
+    uint8_t col = 0;
+    while (col < COLS)
+    {
+        if (text[col] == cache[col])
+        {
+            col++;
+            continue;
+        }
+
+        // Send one run of changed characters
+        char run[COLS + 1];
+        uint8_t start = col;
+        uint8_t n = 0;
+        while (col < COLS && text[col] != cache[col])
+        {
+            run[n++] = text[col];
+            cache[col] = text[col];
+            col++;
+        }
+        run[n] = '\0';
+
+        u8x8.drawString(start, row, run);
+        flushBytes += (uint16_t)n * 8;
+    }
+}
+
+void Display::drawBar(uint8_t width)
+{
+    // Fill occupies columns BAR_X .. BAR_X + width - 1 of the 128px row
+    uint8_t firstTile = 0;
+    uint8_t lastTile = COLS - 1;
+
+    if (barValid)
+    {
+        if (width == shownBar)
+            return;
+
+        uint8_t lo = min(width, shownBar);
+        uint8_t hi = max(width, shownBar);
+        firstTile = (BAR_X + lo) / 8;
+        lastTile = (BAR_X + hi - 1) / 8;
+    }
+
+    for (uint8_t t = firstTile; t <= lastTile; t++)
+    {
+        uint8_t tile[8];
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            uint8_t x = t * 8 + i;
+            if (x == 0 || x == 127)
+                tile[i] = BAR_EDGE;
+            else if (x >= BAR_X && x < BAR_X + width)
+                tile[i] = BAR_FILL;
+            else
+                tile[i] = BAR_EMPTY;
+        }
+        u8x8.drawTile(t, ROW_BAR, 1, tile);
+        flushBytes += 8;
+    }
+
+    shownBar = width;
+    barValid = true;
+}
+
+#endif // DISPLAY_USE_U8X8
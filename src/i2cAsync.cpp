@@ -0,0 +1,162 @@
+/**
+ * @file i2cAsync.cpp
+ * @brief Implementation of interrupt-driven TWI master transmitter
+ * @version 1.0.0
+ * 
+ * State machine (TWI status after each TWINT):
+ *  - START / REP_START → send SLA+W
+ *  - SLA+W ACK         → send control byte (if any) or first payload byte
+ *  - DATA ACK          → next payload byte; at segment end pull the next
+ *                        segment (REP_START) or finish with STOP
+ *  - anything else     → STOP, count error, go idle
+ * 
+ * Only compiled into builds that enable DISPLAY_ASYNC_FLUSH, so the
+ * vector does not collide with Wire in the default configuration.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "i2cAsync.h"
+
+#if DISPLAY_ASYNC_FLUSH
+
+#include <util/twi.h>
+
+namespace
+{
+    const uint8_t TWCR_RUN = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+
+    volatile bool streaming = false;
+    volatile uint16_t errorCount = 0;
+
+    uint8_t slaW = 0;                   // Address byte (write)
+    I2cSegmentSource source = nullptr;  // Segment provider
+    I2cSegment seg;                     // Segment being sent
+    uint8_t pos = 0;                    // Next payload byte
+    bool controlPending = false;        // Control byte not sent yet
+
+    // Single-segment source for writeBlocking()
+    I2cSegment oneShot;
+    bool oneShotTaken = false;
+
+    bool oneShotSource(I2cSegment& s)
+    {
+        if (oneShotTaken)
+            return false;
+        oneShotTaken = true;
+        s = oneShot;
+        return true;
+    }
+
+    inline void finish(uint8_t twcr)
+    {
+        TWCR = twcr;
+        streaming = false;
+    }
+}
+
+void I2cAsync::begin(uint32_t clockHz)
+{
+    // Internal pull-ups on SDA (A4) / SCL (A5)
+    digitalWrite(SDA, HIGH);
+    digitalWrite(SCL, HIGH);
+
+    // Prescaler 1: SCL = F_CPU / (16 + 2 * TWBR)
+    TWSR = 0;
+    TWBR = (uint8_t)(((F_CPU / clockHz) - 16) / 2);
+    TWCR = _BV(TWEN);
+}
+
+bool I2cAsync::busy()
+{
+    return streaming;
+}
+
+uint16_t I2cAsync::errors()
+{
+    uint16_t n;
+    uint8_t oldSREG = SREG;
+    cli();
+    n = errorCount;
+    SREG = oldSREG;
+    return n;
+}
+
+void I2cAsync::start(uint8_t address, I2cSegmentSource src)
+{
+    while (streaming) {}
+    // Let a previous STOP complete on the bus
+    while (TWCR & _BV(TWSTO)) {}
+
+    slaW = (uint8_t)(address << 1);
+    source = src;
+    if (!source(seg))
+        return;
+
+    pos = 0;
+    controlPending = seg.useControl;
+    streaming = true;
+    TWCR = TWCR_RUN | _BV(TWSTA);
+}
+
+void I2cAsync::writeBlocking(uint8_t address, const uint8_t* data, uint8_t len)
+{
+    while (streaming) {}
+
+    oneShot.data = data;
+    oneShot.len = len;
+    oneShot.useControl = false;
+    oneShotTaken = false;
+
+    start(address, oneShotSource);
+    while (streaming) {}
+}
+
+ISR(TWI_vect)
+{
+    switch (TW_STATUS)
+    {
+        case TW_START:
+        case TW_REP_START:
+            TWDR = slaW;
+            TWCR = TWCR_RUN;
+            return;
+
+        case TW_MT_SLA_ACK:
+        case TW_MT_DATA_ACK:
+            if (controlPending)
+            {
+                controlPending = false;
+                TWDR = seg.control;
+                TWCR = TWCR_RUN;
+                return;
+            }
+            if (pos < seg.len)
+            {
+                TWDR = seg.data[pos++];
+                TWCR = TWCR_RUN;
+                return;
+            }
+
+            // Segment complete: chain the next one or release the bus
+            if (source(seg))
+            {
+                pos = 0;
+                controlPending = seg.useControl;
+                TWCR = TWCR_RUN | _BV(TWSTA);
+                return;
+            }
+            finish(_BV(TWINT) | _BV(TWEN) | _BV(TWSTO));
+            return;
+
+        default:
+            // NACK, arbitration lost or bus error: abandon the stream
+            errorCount++;
+            finish(_BV(TWINT) | _BV(TWEN) | _BV(TWSTO));
+            return;
+    }
+}
+
+#endif // DISPLAY_ASYNC_FLUSH
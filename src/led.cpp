@@ -3,6 +3,21 @@
  * @brief Implementation of RGB LED status indicator
  * @version 2.0.0
  * 
+ * Color gradient lookup:
+ *  - 101 entries (0..100%), generated by StatusLED::gradientColor() at
+ *    compile time and stored in PROGMEM (202 bytes of flash)
+ *  - update() does one table read per tick instead of float division,
+ *    so the soft-float routines are no longer linked
+ * 
+ * Gamma correction:
+ *  - setRGB() maps each channel through a 256-entry γ=2.5 table
+ *    (constexpr-generated, 256 bytes of flash)
+ *  - Callers keep working in linear intensity (0-255)
+ * 
+ * Effects:
+ *  - 50% -> 0% blink: LAYER_TRANSITION, scales the gradient max/dim
+ *  - Error: LAYER_FAULT, replaces the gradient with a blue 500ms blink
+ * 
  * @author Michael Garcia, M&E Design
  * @contact michael@mandedesign.studio
  * @website www.mandedesign.studio
@@ -11,6 +26,30 @@
  */
 
 #include "led.h"
+#include "constTable.h"
+#include "ledBam.h"
+
+// -----------------------------------------------------------------------------
+// Effect keyframe tables
+// -----------------------------------------------------------------------------
+
+const LedKeyframe StatusLED::BLINK_TO_ZERO_FRAMES[] PROGMEM = {
+    { DIM_BRIGHTNESS, DIM_BRIGHTNESS, DIM_BRIGHTNESS, LED_EASE_STEP, BLINK_HALF_PERIOD_MS },
+    { MAX_BRIGHTNESS, MAX_BRIGHTNESS, MAX_BRIGHTNESS, LED_EASE_STEP, BLINK_HALF_PERIOD_MS },
+};
+
+const LedKeyframe StatusLED::ERROR_FRAMES[] PROGMEM = {
+    { 0, 0, 0,              LED_EASE_STEP, ERROR_BLINK_MS },
+    { 0, 0, MAX_BRIGHTNESS, LED_EASE_STEP, ERROR_BLINK_MS },
+};
+
+const LedSequence StatusLED::BLINK_TO_ZERO_SEQ PROGMEM = {
+    BLINK_TO_ZERO_FRAMES, 2, LED_BLEND_SCALE, true
+};
+
+const LedSequence StatusLED::ERROR_SEQ PROGMEM = {
+    ERROR_FRAMES, 2, LED_BLEND_REPLACE, true
+};
 
 void StatusLED::begin()
 {
@@ -18,17 +57,34 @@ void StatusLED::begin()
     pinMode(PIN_R, OUTPUT);
     pinMode(PIN_G, OUTPUT);
     pinMode(PIN_B, OUTPUT);
+
+#if LED_USE_BAM
+    // All three channels dimmed from the Timer0 compare interrupt
+    LedBam::begin();
+#endif
     
     // Initialize LED to off state
     setRGB(0, 0, 0);
+    lastUpdateMs = millis();
 }
 
 void StatusLED::setRGB(uint8_t r, uint8_t g, uint8_t b)
 {
+    // Perceptual correction: linear intensity → gamma-corrected duty
+    typedef ConstTable<uint8_t, &StatusLED::gammaCorrect, 256> GammaLut;
+    r = pgm_read_byte(&GammaLut::data[r]);
+    g = pgm_read_byte(&GammaLut::data[g]);
+    b = pgm_read_byte(&GammaLut::data[b]);
+
+#if LED_USE_BAM
+    // Common anode LED (active LOW - inverted logic), BAM on all channels
+    LedBam::write(255 - r, 255 - g, 255 - b);
+#else
     // Common anode LED (active LOW - inverted logic)
     analogWrite(PIN_R, 255 - r);
     analogWrite(PIN_G, 255 - g);
     analogWrite(PIN_B, 255 - b);
+#endif
     
     // amazonq-ignore-next-line
     // For common cathode LED, use these lines instead:
@@ -39,34 +95,23 @@ void StatusLED::setRGB(uint8_t r, uint8_t g, uint8_t b)
 
 void StatusLED::setError(bool active)
 {
-    if (active && !errorActive)
+    bool playing = effects.isPlaying(LedSequencer::LAYER_FAULT);
+
+    if (active && !playing)
     {
-        // Entering error mode: reset timing
-        lastErrorBlinkMs = millis();
-        errorBlinkOn = false;
+        // Entering error mode: restart the blink from its off phase
+        effects.play(LedSequencer::LAYER_FAULT, &ERROR_SEQ, millis());
+    }
+    else if (!active && playing)
+    {
+        effects.stop(LedSequencer::LAYER_FAULT);
     }
-    errorActive = active;
 }
 
 void StatusLED::update(int commandedPercent)
 {
     unsigned long now = millis();
 
-    // Error mode: blue blink @ 500ms
-    if (errorActive)
-    {
-        if (now - lastErrorBlinkMs >= ERROR_BLINK_MS)
-        {
-            lastErrorBlinkMs = now;
-            errorBlinkOn = !errorBlinkOn;
-        }
-
-        // Blue on/off, R & G off
-        uint8_t b = errorBlinkOn ? MAX_BRIGHTNESS : 0;
-        setRGB(0, 0, b);
-        return;
-    }
-
     // Constrain input to valid range
     // amazonq-ignore-next-line
     commandedPercent = constrain(commandedPercent, 0, 100);
@@ -74,64 +119,58 @@ void StatusLED::update(int commandedPercent)
     // Detect speed change and transition type
     if (commandedPercent != targetPercent)
     {
-        // Enable special blinking effect for 50% -> 0% transition
+        // Special blinking effect for 50% -> 0% transition
         if (lastCommand == 50 && commandedPercent == 0)
         {
-            blinkingToZero = true;
+            effects.play(LedSequencer::LAYER_TRANSITION, &BLINK_TO_ZERO_SEQ, now);
         }
         else
         {
-            blinkingToZero = false;
+            effects.stop(LedSequencer::LAYER_TRANSITION);
         }
 
         targetPercent = commandedPercent;
         lastCommand = commandedPercent;
     }
 
-    // Smooth transition: increment/decrement currentPercent toward target
-    if (now - lastStepMs >= STEP_INTERVAL_MS)
+    // Smooth transition: exponential approach based on elapsed time.
+    // alpha = dt / (tau + dt) ≈ 1 - e^(-dt/tau), Q16; a late tick takes a
+    // proportionally bigger step, so latency is bounded by tau, not by
+    // how often update() runs.
+    unsigned long dt = now - lastUpdateMs;
+    lastUpdateMs = now;
+
+    int16_t targetQ8 = (int16_t)(targetPercent << 8);
+    int16_t diff = targetQ8 - currentQ8;
+    if (diff != 0 && dt > 0)
     {
-        lastStepMs = now;
+        if (dt > 0xFFFFUL) dt = 0xFFFFUL;
+        uint32_t alphaQ16 = (dt << 16) / (TRANSITION_TAU_MS + dt);
+        int16_t step = (int16_t)(((int32_t)diff * (int32_t)alphaQ16) >> 16);
 
-        if (currentPercent < targetPercent) currentPercent++;
-        else if (currentPercent > targetPercent) currentPercent--;
+        // Always make progress so the approach terminates
+        if (step == 0) step = (diff > 0) ? 1 : -1;
+        currentQ8 += step;
     }
+    currentPercent = (currentQ8 + 0x80) >> 8;
 
-    // Map currentPercent (0-100) to RGB color gradient
-    // 0% = Red (255,0,0), 50% = Yellow (255,255,0), 100% = Green (0,255,0)
-    uint8_t r, g, b;
-    b = 0;  // Blue channel unused
-
-    if (currentPercent <= COLOR_TRANSITION_THRESHOLD)
-    {
-        // Red -> Yellow: red stays max, green ramps up
-        float t = currentPercent / (float)COLOR_TRANSITION_THRESHOLD;
-        r = MAX_BRIGHTNESS;
-        g = (uint8_t)(MAX_BRIGHTNESS * t);
-    }
-    else
+    // Transition effect ends once the LED has reached its target
+    if (currentPercent == targetPercent)
     {
-        // Yellow -> Green: green stays max, red ramps down
-        float t = (currentPercent - COLOR_TRANSITION_THRESHOLD) / (float)COLOR_TRANSITION_THRESHOLD;
-        r = (uint8_t)(MAX_BRIGHTNESS * (1.0f - t));
-        g = MAX_BRIGHTNESS;
+        effects.stop(LedSequencer::LAYER_TRANSITION);
     }
 
-    // Apply blinking effect during 50% -> 0% transition
-    if (blinkingToZero && currentPercent > 0)
-    {
-        // Toggle blink state at regular intervals
-        if (now - lastBlinkMs >= BLINK_HALF_PERIOD_MS)
-        {
-            lastBlinkMs = now;
-            lastBlinkState = !lastBlinkState;
-        }
-        
-        // Scale brightness between max and dim
-        uint8_t scale = lastBlinkState ? MAX_BRIGHTNESS : DIM_BRIGHTNESS;
-        r = (uint8_t)((uint16_t)r * scale / MAX_BRIGHTNESS);
-        g = (uint8_t)((uint16_t)g * scale / MAX_BRIGHTNESS);
-    }
+    // Map currentPercent (0-100) to RGB color gradient (PROGMEM table)
+    typedef ConstTable<GradientColor, &StatusLED::gradientColor, 101> GradientLut;
+    GradientColor c;
+    memcpy_P(&c, &GradientLut::data[currentPercent], sizeof(c));
+
+    uint8_t r = c.r;
+    uint8_t g = c.g;
+    uint8_t b = 0;  // Blue channel unused by the gradient
+
+    // Compose effect layers (transition blink, fault) over the gradient
+    effects.render(r, g, b, now);
 
     // Update LED with calculated color
     setRGB(r, g, b);
@@ -0,0 +1,111 @@
+/**
+ * @file ledBam.cpp
+ * @brief Implementation of bit-angle modulation LED driver
+ * @version 1.0.0
+ * 
+ * write() precomputes, for every bit position, the PORTD / PORTB bits
+ * that are HIGH during that slot, copies them into the buffer the ISR is
+ * not using (16 bytes, interrupts off) and publishes its index. The ISR
+ * only copies precomputed patterns to the ports, and latches the buffer
+ * index at frame start so a frame never mixes two colors.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "ledBam.h"
+
+#if LED_USE_BAM
+
+namespace
+{
+    const uint8_t MASK_D = _BV(PD3) | _BV(PD2);   // R, B
+    const uint8_t MASK_B = _BV(PB3);              // G
+
+    const uint8_t CYCLES_PER_TICK = F_CPU / 250000UL;  // 64 @ 16MHz
+    const uint8_t WRITE_CYCLES = 6;                    // port update overhead
+
+    uint8_t patternD[2][8];         // PORTD bits per BAM slot
+    uint8_t patternB[2][8];         // PORTB bits per BAM slot
+    volatile uint8_t pendingBuf = 0;  // Buffer published by write()
+    volatile uint8_t activeBuf = 0;   // Buffer in use by the ISR
+    uint8_t slot = 0;               // Next BAM bit to emit (ISR only)
+
+    inline void output(uint8_t k)
+    {
+        PORTD = (PORTD & ~MASK_D) | patternD[activeBuf][k];
+        PORTB = (PORTB & ~MASK_B) | patternB[activeBuf][k];
+    }
+}
+
+void LedBam::begin()
+{
+    DDRD |= MASK_D;
+    DDRB |= MASK_B;
+
+    write(0, 0, 0);
+
+    // First compare shortly after now, then self-advancing
+    uint8_t oldSREG = SREG;
+    cli();
+
+    // Normal mode: unbuffered OCR0B, same 256-tick overflow for millis().
+    // Also disconnects OC0A/OC0B (no analogWrite() on D5/D6).
+    TCCR0A &= ~(_BV(WGM01) | _BV(WGM00) |
+                _BV(COM0A1) | _BV(COM0A0) | _BV(COM0B1) | _BV(COM0B0));
+
+    slot = 0;
+    OCR0B = TCNT0 + 16;
+    TIFR0 = _BV(OCF0B);
+    TIMSK0 |= _BV(OCIE0B);
+    SREG = oldSREG;
+}
+
+void LedBam::write(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint8_t d[8];
+    uint8_t p[8];
+    for (uint8_t k = 0; k < 8; k++)
+    {
+        uint8_t bit = _BV(k);
+        d[k] = ((r & bit) ? _BV(PD3) : 0) | ((b & bit) ? _BV(PD2) : 0);
+        p[k] = (g & bit) ? _BV(PB3) : 0;
+    }
+
+    // Fill the buffer the ISR is not using; short critical section so
+    // the frame-start latch cannot see a half-written buffer
+    uint8_t oldSREG = SREG;
+    cli();
+    uint8_t back = activeBuf ^ 1;
+    memcpy(patternD[back], d, sizeof(d));
+    memcpy(patternB[back], p, sizeof(p));
+    pendingBuf = back;
+    SREG = oldSREG;
+}
+
+ISR(TIMER0_COMPB_vect)
+{
+    if (slot == 0)
+    {
+        // Frame start: latch latest colors, emit short bits inline
+        activeBuf = pendingBuf;
+
+        output(0);
+        __builtin_avr_delay_cycles(1 * CYCLES_PER_TICK - WRITE_CYCLES);
+        output(1);
+        __builtin_avr_delay_cycles(2 * CYCLES_PER_TICK - WRITE_CYCLES);
+        output(2);
+
+        // Bit 2 lasts 4 ticks, measured from the 3 ticks spent inline
+        OCR0B += 3 + 4;
+        slot = 3;
+        return;
+    }
+
+    output(slot);
+    OCR0B += (uint8_t)(1 << slot);
+    slot = (slot == 7) ? 0 : slot + 1;
+}
+
+#endif // LED_USE_BAM
@@ -0,0 +1,106 @@
+/**
+ * @file ledSequencer.cpp
+ * @brief Implementation of keyframe LED animation engine
+ * @version 1.0.0
+ * 
+ * Keyframes are read from flash (memcpy_P) one at a time; RAM cost is
+ * one LayerState per layer. Interpolation is integer (Q8 fraction).
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "ledSequencer.h"
+#include <string.h>
+
+/// @brief Copy a PROGMEM record (plain copy on the host)
+static void readFlash(void* dst, const void* src, size_t size)
+{
+#if defined(__AVR__)
+    memcpy_P(dst, src, size);
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+void LedSequencer::play(Layer layer, const LedSequence* sequence, unsigned long now)
+{
+    LedSequence seq;
+    readFlash(&seq, sequence, sizeof(seq));
+
+    LayerState& s = layers[layer];
+    s.frames = seq.frames;
+    s.count = seq.count;
+    s.blend = seq.blend;
+    s.loop = seq.loop;
+    s.index = 0;
+    s.frameStartMs = now;
+}
+
+void LedSequencer::stop(Layer layer)
+{
+    layers[layer].count = 0;
+}
+
+void LedSequencer::render(uint8_t& r, uint8_t& g, uint8_t& b, unsigned long now)
+{
+    for (uint8_t i = 0; i < LAYER_COUNT; i++)
+    {
+        LayerState& s = layers[i];
+        if (s.count == 0)
+            continue;
+
+        LedKeyframe kf;
+        readFlash(&kf, &s.frames[s.index], sizeof(kf));
+
+        // Advance past finished keyframes (handles late/missed ticks);
+        // a zero-length keyframe holds until stop() / play()
+        while (kf.durationMs != 0 && now - s.frameStartMs >= kf.durationMs)
+        {
+            s.frameStartMs += kf.durationMs;
+            if (++s.index >= s.count)
+            {
+                if (!s.loop)
+                {
+                    s.count = 0;
+                    break;
+                }
+                s.index = 0;
+            }
+            readFlash(&kf, &s.frames[s.index], sizeof(kf));
+        }
+        if (s.count == 0)
+            continue;
+
+        uint8_t kr = kf.r;
+        uint8_t kg = kf.g;
+        uint8_t kb = kf.b;
+
+        if (kf.easing == LED_EASE_LINEAR && kf.durationMs > 0)
+        {
+            uint8_t next = (s.index + 1 < s.count) ? s.index + 1 : (s.loop ? 0 : s.index);
+            LedKeyframe nk;
+            readFlash(&nk, &s.frames[next], sizeof(nk));
+
+            // t in Q8 (0..255)
+            uint16_t t = (uint16_t)(((uint32_t)(now - s.frameStartMs) << 8) / kf.durationMs);
+            kr = (uint8_t)(kr + (((int32_t)nk.r - kr) * t >> 8));
+            kg = (uint8_t)(kg + (((int32_t)nk.g - kg) * t >> 8));
+            kb = (uint8_t)(kb + (((int32_t)nk.b - kb) * t >> 8));
+        }
+
+        if (s.blend == LED_BLEND_SCALE)
+        {
+            r = (uint8_t)((uint16_t)r * kr / 255);
+            g = (uint8_t)((uint16_t)g * kg / 255);
+            b = (uint8_t)((uint16_t)b * kb / 255);
+        }
+        else
+        {
+            r = kr;
+            g = kg;
+            b = kb;
+        }
+    }
+}
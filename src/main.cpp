@@ -10,12 +10,32 @@
  *        Enter timed maneuver:
  *           STOP (500ms) → REVERSE (200ms) → SLOW-FWD (until next valid reading)
  *  - All transitions are NON-BLOCKING (millis-based), no delay()
+ *  - Control law (control.h): distance mapping + maneuver state machine;
+ *    with CONTROL_TIMER_ISR=1 it runs with the motor outputs from a
+ *    100 Hz Timer2 interrupt and loop() only feeds it sensor readings
+ *  - Cooperative static task table (scheduler.h): control 100 Hz,
+ *    LED 50 Hz, display 5 Hz, serial/button/telemetry in the slack.
+ *    Each task runs at its own period; the display renders a snapshot
+ *    of control state and can no longer hold the control rate down
+ *  - OLED pages (status, history, loop timing, sensor health, motor
+ *    state) cycle on the D4 button or serial 'p'; 'g' toggles history;
+ *    'r' prints the last frame's render / flush cost, 't' task timing
+ *    and CPU load (the scheduler sleeps in SLEEP_MODE_IDLE when idle)
+ *  - Hardware watchdog petted only while the control task meets its
+ *    deadline; 5 misses in a row stop the motor. If petting stops its
+ *    interrupt stops the motor, and the next timeout resets the
+ *    board. The reset cause is printed at boot and shown on the loop page
+ *  - EVENT_PIPELINE=1: the echo is captured by a pin-change interrupt
+ *    that posts a range event; control recomputes only on new input and
+ *    posts speed / distance change events to the LED and display
+ *  - PROFILE_ENABLED=1: per-stage min/avg/max + histogram, 'f' dumps
  * 
  * System Components:
  *  - HC-SR04 ultrasonic
  *  - L293D motor driver
  *  - StatusLED gradient + error + blinking transitions
  *  - SSD1306 OLED status display
+ *  - Motor supply monitor (PWM compensation for battery sag)
  */
 
 #include <Arduino.h>
@@ -23,17 +43,32 @@
 #include "ultraSonic.h"
 #include "led.h"
 #include "display.h"
+#include "supply.h"
+#include "telemetry.h"
+#include "scheduler.h"
+#include "control.h"
+#include "profiler.h"
+#include "watchdog.h"
+#include "events.h"
 
 // -----------------------------------------------------------------------------
 // Control parameters
 // -----------------------------------------------------------------------------
 
-static const unsigned long UPDATE_INTERVAL_MS = 10;  // main loop pacing
-static const unsigned long STOP_TIME_MS       = 500; // stop before reversing
-static const unsigned long REVERSE_TIME_MS    = 200; // reverse duration
+static const uint16_t CONTROL_PERIOD_MS = 10;  // control task (100 Hz)
+static const uint16_t LED_PERIOD_MS     = 20;   // LED task (50 Hz)
+static const uint16_t DISPLAY_PERIOD_MS = 200;  // OLED refresh (5 Hz)
+static const unsigned long BUTTON_DEBOUNCE_MS = 30;   // page button settle time
 
-static const int MIN_DIST_CM = 5;    // distance where commanded = 0%
-static const int MAX_DIST_CM = 60;   // distance where commanded = 100%
+static const uint8_t PAGE_BUTTON_PIN = 4;   // D4 to GND, internal pull-up
+static const uint8_t SERIAL_LINE_ROOM = 60; // free TX bytes before a report line (64-byte buffer)
+
+// Longest report lines incl. CRLF: 48 ("task N last us=65535 max us=65535
+// misses=65535", "isr us=... max latency us=65535"), profiler histogram 46
+#if PROFILE_ENABLED
+static_assert(Profiler::DUMP_LINE_MAX <= SERIAL_LINE_ROOM,
+              "profiler row must fit SERIAL_LINE_ROOM");
+#endif
 
 // -----------------------------------------------------------------------------
 // Hardware objects
@@ -43,145 +78,501 @@ Motor      motor;
 UltraSonic usonic;
 StatusLED  statusLed;
 Display    display;
+SupplyMonitor supply;
 
 // -----------------------------------------------------------------------------
-// Motor maneuver state machine
+// Control law (maneuver state machine lives in Controller)
 // -----------------------------------------------------------------------------
 
-enum MotorMode { NORMAL, STOPPING, REVERSING, SLOW_FORWARD };
-MotorMode motorMode = NORMAL;
+Controller controller;
+Watchdog watchdog;
 
-unsigned long modeStartMs = 0;
-unsigned long lastUpdateMs = 0;
+static void watchdogTimeout();
 
-int lastSpeedPct = 100;
 bool errorState = false;
 
+// -----------------------------------------------------------------------------
+// Telemetry snapshot (written at end of control tick, read by LED / display)
+// -----------------------------------------------------------------------------
+
+Telemetry telemetry = {};
+
+#if EVENT_PIPELINE
+// -----------------------------------------------------------------------------
+// Event pipeline: echo ISR → control → LED / display (SPSC rings, no heap)
+// -----------------------------------------------------------------------------
+
+EventRing rangeEvents;              // Echo capture ISR → control task
+EventRing outputEvents;             // Control task → subscribers (background task)
+
+bool displayDirty = true;           // Main page needs a redraw
+Display::Page shownPage = Display::PAGE_COUNT;  // Page of the last frame
+
+static void ledOnSpeed(const Event& e);
+static void displayOnChange(const Event& e);
+
+const EventSubscription subscriptions[] = {
+    //  event                   handler
+    {   EVENT_SPEED_CHANGED,    ledOnSpeed      },
+    {   EVENT_SPEED_CHANGED,    displayOnChange },
+    {   EVENT_DISTANCE_CHANGED, displayOnChange },
+};
+#endif
+
+// -----------------------------------------------------------------------------
+// Serial reports ('t', 'r', 'f'): printed a line at a time by serialTask
+// -----------------------------------------------------------------------------
+
+enum SerialReport : uint8_t { REPORT_NONE, REPORT_TASKS, REPORT_RENDER, REPORT_PROFILE };
+
+SerialReport report = REPORT_NONE;  // Report being printed
+uint8_t reportLine = 0;             // Its next line
+
+static void startReport(SerialReport r);
+static bool printReportLine(SerialReport r, uint8_t line);
+static bool printTaskLine(uint8_t line);
+
+bool buttonLevel = HIGH;            // Debounced page button level
+bool buttonRaw = HIGH;              // Last raw reading
+unsigned long buttonChangeMs = 0;   // Time of last raw change
+
+// -----------------------------------------------------------------------------
+// Task table (static, no heap)
+// -----------------------------------------------------------------------------
+
+static void controlTask(unsigned long now);
+static void ledTask(unsigned long now);
+static void displayTask(unsigned long now);
+static void backgroundTask(unsigned long now);
+
+enum TaskId { TASK_CONTROL, TASK_LED, TASK_DISPLAY, TASK_BACKGROUND, TASK_COUNT };
+
+SchedTask tasks[TASK_COUNT] = {
+    //  run             period              phase  priority
+    {   controlTask,    CONTROL_PERIOD_MS,  0,     0,   {} },
+    {   ledTask,        LED_PERIOD_MS,      3,     1,   {} },
+    {   displayTask,    DISPLAY_PERIOD_MS,  7,     2,   {} },
+    {   backgroundTask, 0,                  0,     3,   {} },   // slack only
+};
+
+Scheduler scheduler(tasks, TASK_COUNT);
+
 // -----------------------------------------------------------------------------
 // Setup
 // -----------------------------------------------------------------------------
 
 void setup()
 {
+    Serial.begin(115200);
+
+    // Why we (re)started: a watchdog reset means something hung
+    const char* reason = Watchdog::resetReason();
+    Serial.print(F("reset: "));
+    Serial.println(reason ? (const __FlashStringHelper*)reason : F("PWR"));
+    telemetry.resetReason = reason;
+
     motor.begin();
+#if EVENT_PIPELINE
+    usonic.begin(rangeEvents);
+#else
     usonic.begin();
+#endif
     statusLed.begin();
     display.begin();
+    supply.begin();
+    pinMode(PAGE_BUTTON_PIN, INPUT_PULLUP);
+
+    motor.setSpeed(100);
+    statusLed.update(100);
 
-    lastSpeedPct = 100;
-    motor.setSpeed(lastSpeedPct);
-    statusLed.update(lastSpeedPct);
-    display.update(0, lastSpeedPct, false);
+    telemetry.speedPct = 100;
+    display.update(telemetry);
 
-    lastUpdateMs = millis();
+#if CONTROL_TIMER_ISR
+    // From here on the motor belongs to the Timer2 tick
+    ControlTick::begin(controller, motor);
+#endif
+    scheduler.begin();
+    watchdog.begin(watchdogTimeout);
 }
 
 // -----------------------------------------------------------------------------
 // LOOP
 // -----------------------------------------------------------------------------
 
+static void serialTask();
+static void buttonTask(unsigned long now);
+static void safeStop();
+
 void loop()
 {
-    unsigned long now = millis();
+    scheduler.dispatch();
+}
 
-    if (now - lastUpdateMs < UPDATE_INTERVAL_MS)
-        return;
-    lastUpdateMs = now;
+// -----------------------------------------------------------------------------
+// Control task: sense → maneuver/mapping → motor
+// (timer tick build: sense → hand over; the ISR does the rest)
+// -----------------------------------------------------------------------------
+
+static void controlTask(unsigned long now)
+{
+    // Deadline monitor: pets the watchdog only while control keeps up
+    if (watchdog.check(scheduler.stats(TASK_CONTROL).lateRuns))
+        safeStop();
+    if (watchdog.tripped())
+        return;     // motor held stopped until the watchdog reset
+
+    // Motor supply (background ADC) for duty compensation
+    supply.update();
+
+    PROFILE_START(PROF_READ_CM);
+#if EVENT_PIPELINE
+    bool fresh = false;
+    int distance = telemetry.distance;
+    Event e;
+    while (rangeEvents.pop(e))
+    {
+        distance = usonic.toCM(e.value);
+        fresh = true;
+    }
 
-    // ================================================================
-    // Read ultrasonic distance
-    // ================================================================
+    // Trigger only; the echo ISR posts EVENT_RANGE when the echo ends.
+    // An echo that never ended reads as a timeout, like pulseIn()'s
+    if (usonic.ping())
+    {
+        distance = usonic.toCM(0);
+        fresh = true;
+    }
+#else
+    // Ultrasonic distance (pulseIn: must stay out of interrupt context)
     int distance = usonic.readCM();
-    int speedPct = lastSpeedPct;
+#endif
+    PROFILE_STOP(PROF_READ_CM);
+
+#if CONTROL_TIMER_ISR
+#if EVENT_PIPELINE
+    (void)fresh;    // the timer tick steps every period regardless
+#endif
+    ControlTick::setInputs(distance, supply.millivolts());
+    ControlOutputs o = ControlTick::outputs();
+
+    int speedPct = o.speedPct;
+    telemetry.mode = (ManeuverState)o.mode;
+    telemetry.target = o.target;
+    telemetry.duty = o.duty;
+    telemetry.kick = o.kick;
+#else
+    motor.setSupplyMillivolts(supply.millivolts());
 
-    // ================================================================
-    //  MOTOR MANEUVER STATE MACHINE
-    // ================================================================
-    if (distance >= MAX_DIST_CM)
+    bool recompute = true;
+#if EVENT_PIPELINE
+    // Same input, no maneuver timer or kick pulse running: nothing can change
+    recompute = fresh || controller.mode() != MANEUVER_NORMAL || motor.kicking();
+#endif
+
+    int speedPct = telemetry.speedPct;
+    if (recompute)
     {
-        switch (motorMode)
+        PROFILE_START(PROF_CONTROL);
+        speedPct = controller.step(distance, now);
+        PROFILE_STOP(PROF_CONTROL);
+
+        // Apply outputs (non-blocking)
+        PROFILE_START(PROF_SET_SPEED);
+        motor.setSpeed(speedPct);
+        motor.update();
+        PROFILE_STOP(PROF_SET_SPEED);
+    }
+
+    telemetry.mode = controller.mode();
+    telemetry.target = motor.command();
+    telemetry.duty = motor.appliedDuty();
+    telemetry.kick = motor.kicking();
+#endif
+
+    errorState = false;   // reserved for later diagnostics
+
+#if EVENT_PIPELINE
+    // Post only real output changes
+    if (speedPct != telemetry.speedPct)
+        outputEvents.push({ EVENT_SPEED_CHANGED, (uint16_t)speedPct });
+    if (distance != telemetry.distance)
+        outputEvents.push({ EVENT_DISTANCE_CHANGED, (uint16_t)distance });
+#endif
+
+    // Publish state for the LED and display tasks
+    telemetry.distance = distance;
+    telemetry.speedPct = speedPct;
+    telemetry.error = errorState;
+    telemetry.sensor = usonic.stats();
+    telemetry.supplyMv = supply.millivolts();
+
+    // History plot sample (RAM only, decimated inside Display)
+    display.addSample(distance, speedPct);
+}
+
+// -----------------------------------------------------------------------------
+// Safe stop: control fell MAX_LATE_RUNS deadlines behind
+// -----------------------------------------------------------------------------
+
+static void safeStop()
+{
+#if CONTROL_TIMER_ISR
+    // Take the motor back from the timer tick first
+    ControlTick::halt();
+#endif
+    motor.stop();
+
+    errorState = true;
+    telemetry.error = true;
+    telemetry.speedPct = 0;
+#if EVENT_PIPELINE
+    outputEvents.push({ EVENT_SPEED_CHANGED, 0 });
+#endif
+    Serial.println(F("control deadline lost: motor stopped"));
+}
+
+// Watchdog interrupt (WDT_vect): nothing petted for a whole timeout.
+// Registers only; the reset follows one timeout later.
+static void watchdogTimeout()
+{
+#if CONTROL_TIMER_ISR
+    ControlTick::halt();
+#endif
+    Motor::emergencyStop();
+}
+
+// -----------------------------------------------------------------------------
+// LED task: color follows the published speed (transitions are time-based)
+// -----------------------------------------------------------------------------
+
+static void ledTask(unsigned long)
+{
+    PROFILE_START(PROF_LED);
+    statusLed.setError(telemetry.error);
+    // The level, not the events: a dropped EVENT_SPEED_CHANGED must not
+    // leave the LED on a stale color
+    statusLed.update(telemetry.speedPct);
+    PROFILE_STOP(PROF_LED);
+}
+
+// -----------------------------------------------------------------------------
+// Display task: renders the latest snapshot, never inside the control task
+// -----------------------------------------------------------------------------
+
+static void displayTask(unsigned long)
+{
+    // Close the control timing window
+    const SchedStats& ctl = scheduler.stats(TASK_CONTROL);
+    if (ctl.runs > 0)
+    {
+        telemetry.tickMinUs = ctl.minUs;
+        telemetry.tickMaxUs = ctl.maxUs;
+        telemetry.tickAvgUs = (uint16_t)(ctl.sumUs / ctl.runs);
+        scheduler.clearWindow(TASK_CONTROL);
+    }
+    telemetry.overruns = ctl.misses;
+
+#if EVENT_PIPELINE
+    // Main page: redraw only after a subscribed event or a page change
+    // (the diagnostic pages show timing, which changes with wall time)
+    Display::Page page = display.page();
+    if (page == Display::PAGE_MAIN && page == shownPage && !displayDirty)
+        return;
+
+    // update() would skip this frame; keep the change for the next one
+    if (display.busy())
+        return;
+    shownPage = page;
+    displayDirty = false;
+#endif
+
+    PROFILE_START(PROF_DISPLAY);
+    display.update(telemetry);
+    PROFILE_STOP(PROF_DISPLAY);
+}
+
+#if EVENT_PIPELINE
+// -----------------------------------------------------------------------------
+// Subscribers (called from the background task)
+// -----------------------------------------------------------------------------
+
+static void ledOnSpeed(const Event&)
+{
+    // New target right away; the LED task keeps the transition running
+    statusLed.update(telemetry.speedPct);
+}
+
+static void displayOnChange(const Event&)
+{
+    displayDirty = true;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Background task: user input and telemetry, whenever nothing else is due
+// -----------------------------------------------------------------------------
+
+static void backgroundTask(unsigned long now)
+{
+#if EVENT_PIPELINE
+    dispatchEvents(outputEvents, subscriptions,
+                   sizeof(subscriptions) / sizeof(subscriptions[0]));
+#endif
+    serialTask();
+    buttonTask(now);
+}
+
+// -----------------------------------------------------------------------------
+// Serial commands (single characters, non-blocking)
+// -----------------------------------------------------------------------------
+
+static void serialTask()
+{
+    while (Serial.available() > 0)
+    {
+        char c = (char)Serial.read();
+        if (c == 'p')
+        {
+            display.nextPage();
+        }
+        else if (c == 'g')
         {
-            // ---------------------------------------------------------
-            // entering stop phase
-            // ---------------------------------------------------------
-            case NORMAL:
-                speedPct = 0;
-                motorMode = STOPPING;
-                modeStartMs = now;
-                break;
-
-            // ---------------------------------------------------------
-            // stopping before reverse
-            // ---------------------------------------------------------
-            case STOPPING:
-                speedPct = 0;
-                if (now - modeStartMs >= STOP_TIME_MS)
-                {
-                    motorMode = REVERSING;
-                    modeStartMs = now;
-                }
-                break;
-
-            // ---------------------------------------------------------
-            // reverse for fixed time
-            // ---------------------------------------------------------
-            case REVERSING:
-                speedPct = -20;   // controlled reverse
-                if (now - modeStartMs >= REVERSE_TIME_MS)
-                {
-                    motorMode = SLOW_FORWARD;
-                    modeStartMs = now;
-                }
-                break;
-
-            // ---------------------------------------------------------
-            // creep forward until next meaningful reading
-            // ---------------------------------------------------------
-            case SLOW_FORWARD:
-                speedPct = 20;
-
-                // If obstruction condition returns to NORMAL range,
-                // abort maneuver immediately:
-                if (distance < MAX_DIST_CM)
-                {
-                    motorMode = NORMAL;
-                }
-                break;
+            display.setPage(display.page() == Display::PAGE_GRAPH
+                            ? Display::PAGE_MAIN : Display::PAGE_GRAPH);
         }
+        else if (c == 't')
+        {
+            startReport(REPORT_TASKS);
+        }
+        else if (c == 'r')
+        {
+            startReport(REPORT_RENDER);
+        }
+#if PROFILE_ENABLED
+        else if (c == 'f')
+        {
+            startReport(REPORT_PROFILE);
+        }
+#endif
     }
-    else
-    {
-        // ============================================================
-        // RETURN TO NORMAL MODE (dynamic scaling)
-        // ============================================================
 
-        motorMode = NORMAL;
-        modeStartMs = now;
+    // One report line per pass, and only once it fits the TX buffer:
+    // print() blocks on a full buffer, stalling the background task
+    if (report != REPORT_NONE && Serial.availableForWrite() >= SERIAL_LINE_ROOM)
+    {
+        if (!printReportLine(report, reportLine++))
+            report = REPORT_NONE;
+    }
+}
 
-        // Dynamic mapping 0–100%
-        speedPct = map(distance, MIN_DIST_CM, MAX_DIST_CM, 0, 100);
+static void startReport(SerialReport r)
+{
+    report = r;
+    reportLine = 0;
+}
 
-        // Quantize for smooth motor + smooth LED
-        speedPct = (speedPct / 2) * 2;
-        speedPct = constrain(speedPct, 0, 100);
+/// @brief Print one line of a report; false once past its end
+static bool printReportLine(SerialReport r, uint8_t line)
+{
+    switch (r)
+    {
+        case REPORT_TASKS:
+            return printTaskLine(line);
+        case REPORT_RENDER:
+            if (line != 0)
+                return false;
+            // Render benchmark: compare builds with DISPLAY_SPRITE_DIGITS=0/1
+            Serial.print(F("render us="));
+            Serial.print(display.lastRenderUs());
+            Serial.print(F(" total us="));
+            Serial.print(display.lastFlushUs());
+            Serial.print(F(" bytes="));
+            Serial.println(display.lastFlushBytes());
+            return true;
+#if PROFILE_ENABLED
+        case REPORT_PROFILE:
+            // Per-stage timing since the last dump
+            return Profiler::dumpLine(Serial, line);
+#endif
+        default:
+            return false;
+    }
+}
 
-        // If too close, clamp to 0
-        if (distance <= MIN_DIST_CM)
-            speedPct = 0;
+/// @brief 't' report: one line per task, then load / events / ISR lines
+static bool printTaskLine(uint8_t line)
+{
+    if (line < TASK_COUNT)
+    {
+        // Per-task execution time and deadline misses
+        const SchedStats& t = scheduler.stats(line);
+        Serial.print(F("task "));
+        Serial.print(line);
+        Serial.print(F(" last us="));
+        Serial.print(t.lastUs);
+        Serial.print(F(" max us="));
+        Serial.print(t.maxUs);
+        Serial.print(F(" misses="));
+        Serial.println(t.misses);
+        return true;
+    }
+    line -= TASK_COUNT;
 
-        // 0 reading = free path
-        if (distance == 0)
-            speedPct = 100;
+#if SCHED_IDLE_SLEEP
+    if (line-- == 0)
+    {
+        // Awake share of the last second (rest is SLEEP_MODE_IDLE)
+        Serial.print(F("cpu load="));
+        Serial.print(scheduler.load());
+        Serial.println('%');
+        return true;
+    }
+#endif
+#if EVENT_PIPELINE
+    if (line-- == 0)
+    {
+        Serial.print(F("events dropped range="));
+        Serial.print(rangeEvents.dropped());
+        Serial.print(F(" output="));
+        Serial.println(outputEvents.dropped());
+        return true;
     }
+#endif
+#if CONTROL_TIMER_ISR
+    if (line-- == 0)
+    {
+        ControlOutputs o = ControlTick::outputs();
+        Serial.print(F("isr us="));
+        Serial.print(o.execUs);
+        Serial.print(F(" max us="));
+        Serial.print(o.maxExecUs);
+        Serial.print(F(" max latency us="));
+        Serial.println(o.maxLatencyUs);
+        return true;
+    }
+#endif
+    return false;
+}
 
-    lastSpeedPct = speedPct;
-    errorState   = false;   // reserved for later diagnostics
+// -----------------------------------------------------------------------------
+// Page button (D4, active low, debounced, acts on press)
+// -----------------------------------------------------------------------------
+
+static void buttonTask(unsigned long now)
+{
+    bool raw = digitalRead(PAGE_BUTTON_PIN);
+    if (raw != buttonRaw)
+    {
+        buttonRaw = raw;
+        buttonChangeMs = now;
+        return;
+    }
 
-    // ================================================================
-    // APPLY OUTPUTS (non-blocking)
-    // ================================================================
-    motor.setSpeed(speedPct);
-    statusLed.setError(errorState);
-    statusLed.update(speedPct);
-    display.update(distance, speedPct, errorState);
+    if (raw != buttonLevel && now - buttonChangeMs >= BUTTON_DEBOUNCE_MS)
+    {
+        buttonLevel = raw;
+        if (buttonLevel == LOW)
+            display.nextPage();
+    }
 }
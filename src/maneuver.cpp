@@ -0,0 +1,114 @@
+/**
+ * @file maneuver.cpp
+ * @brief Maneuver transition table and engine
+ * @version 1.0.0
+ *
+ * The table reproduces the previous nested switch. That switch had a
+ * dead SLOW_FORWARD exit: its distance < MAX_DIST_CM check sat inside the
+ * distance >= MAX_DIST_CM branch and could never fire (the shared else
+ * branch did the work). Here every state checks GUARD_IN_RANGE first, so
+ * SLOW_FORWARD leaves on a valid in-range reading through its own row.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "maneuver.h"
+#include <string.h>
+
+const ManeuverTransition MANEUVER_TABLE[] MANEUVER_PROGMEM = {
+    //  state                   guard               action          timeout next
+    {   MANEUVER_NORMAL,        GUARD_OUT_OF_RANGE, ACTION_STOP,    0,      MANEUVER_STOPPING     },
+    {   MANEUVER_NORMAL,        GUARD_ALWAYS,       ACTION_MAP,     0,      MANEUVER_NORMAL       },
+
+    {   MANEUVER_STOPPING,      GUARD_IN_RANGE,     ACTION_MAP,     0,      MANEUVER_NORMAL       },
+    {   MANEUVER_STOPPING,      GUARD_TIMEOUT,      ACTION_STOP,    500,    MANEUVER_REVERSING    },
+    {   MANEUVER_STOPPING,      GUARD_ALWAYS,       ACTION_STOP,    0,      MANEUVER_STOPPING     },
+
+    {   MANEUVER_REVERSING,     GUARD_IN_RANGE,     ACTION_MAP,     0,      MANEUVER_NORMAL       },
+    {   MANEUVER_REVERSING,     GUARD_TIMEOUT,      ACTION_REVERSE, 200,    MANEUVER_SLOW_FORWARD },
+    {   MANEUVER_REVERSING,     GUARD_ALWAYS,       ACTION_REVERSE, 0,      MANEUVER_REVERSING    },
+
+    {   MANEUVER_SLOW_FORWARD,  GUARD_IN_RANGE,     ACTION_MAP,     0,      MANEUVER_NORMAL       },
+    {   MANEUVER_SLOW_FORWARD,  GUARD_ALWAYS,       ACTION_CREEP,   0,      MANEUVER_SLOW_FORWARD },
+};
+
+const uint8_t MANEUVER_TABLE_ROWS = sizeof(MANEUVER_TABLE) / sizeof(MANEUVER_TABLE[0]);
+
+/// @brief Copy a row out of flash (plain copy on the host)
+static void readRow(ManeuverTransition& dst, const ManeuverTransition* src)
+{
+#if defined(__AVR__)
+    memcpy_P(&dst, src, sizeof(dst));
+#else
+    memcpy(&dst, src, sizeof(dst));
+#endif
+}
+
+ManeuverEngine::ManeuverEngine(const ManeuverTransition* table, uint8_t rows)
+    : table(table), rows(rows)
+{
+}
+
+int ManeuverEngine::step(int distance, uint32_t nowMs)
+{
+    for (uint8_t i = 0; i < rows; i++)
+    {
+        ManeuverTransition t;
+        readRow(t, &table[i]);
+
+        if (t.state != current || !guardHolds(t, distance, nowMs))
+            continue;
+
+        if (t.next != current)
+        {
+            current = (ManeuverState)t.next;
+            enteredMs = nowMs;
+        }
+        return output(t.action, distance);
+    }
+
+    // No row for this state: fail safe
+    return 0;
+}
+
+bool ManeuverEngine::guardHolds(const ManeuverTransition& t, int distance, uint32_t nowMs) const
+{
+    switch (t.guard)
+    {
+        case GUARD_ALWAYS:       return true;
+        case GUARD_IN_RANGE:     return distance < MAX_DIST_CM;
+        case GUARD_OUT_OF_RANGE: return distance >= MAX_DIST_CM;
+        case GUARD_TIMEOUT:      return (uint32_t)(nowMs - enteredMs) >= t.timeoutMs;
+        default:                 return false;
+    }
+}
+
+int ManeuverEngine::output(uint8_t action, int distance)
+{
+    switch (action)
+    {
+        case ACTION_MAP:     return mapDistance(distance);
+        case ACTION_REVERSE: return -REVERSE_PCT;
+        case ACTION_CREEP:   return CREEP_PCT;
+        default:             return 0;
+    }
+}
+
+int ManeuverEngine::mapDistance(int distance)
+{
+    // 0 reading = free path
+    if (distance == 0)
+        return 100;
+
+    // Too close: stop
+    if (distance <= MIN_DIST_CM)
+        return 0;
+
+    // Linear 0–100%, quantized to 2% for smooth motor + smooth LED
+    long pct = ((long)(distance - MIN_DIST_CM) * 100) / (MAX_DIST_CM - MIN_DIST_CM);
+    pct = (pct / 2) * 2;
+    if (pct > 100) pct = 100;
+    return (int)pct;
+}
@@ -14,6 +14,14 @@
  * Deadband is applied around 0 to avoid tiny duty cycles causing
  * audible whine or ineffective motion.
  * 
+ * Supply compensation multiplies the mapped duty by a cached Q8.8 gain
+ * (nominal / actual supply). The division happens only when the supply
+ * reading changes, never per setSpeed() call.
+ * 
+ * Kick-start: a transition from 0 (or a direction change) to a command
+ * below kickPercent applies kickPercent for kickMs, then update() drops
+ * the output to the commanded duty.
+ * 
  * @author Michael Garcia, M&E Design
  * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
  * @license MIT License
@@ -21,6 +29,8 @@
 
 #include "motor.h"
 
+volatile bool Motor::outputsLatchedOff = false;
+
 void Motor::begin()
 {
     pinMode(IN1, OUTPUT);
@@ -31,27 +41,39 @@ void Motor::begin()
 
 void Motor::applyOutputs(int pwmValue, bool forward)
 {
-    // pwmValue is 0..255
-    if (pwmValue <= 0)
+    // Latch check and pin writes as one unit: a WDT_vect between them
+    // would have its Timer1 disconnect undone by analogWrite()
+    uint8_t sreg = SREG;
+    cli();
+
+    if (outputsLatchedOff)
+    {
+        // emergencyStop() owns the bridge until reset
+        appliedPwm = 0;
+    }
+    else if (pwmValue <= 0)
     {
         // Coast / stop: both inputs LOW
+        appliedPwm = 0;
         digitalWrite(IN1, LOW);
         digitalWrite(IN2, LOW);
-        return;
     }
-
-    if (forward)
+    else if (forward)
     {
-        // Forward: IN1 PWM, IN2 LOW
+        // Forward: IN1 PWM, IN2 LOW (pwmValue is 1..255)
+        appliedPwm = pwmValue;
         analogWrite(IN1, pwmValue);
         digitalWrite(IN2, LOW);
     }
     else
     {
         // Reverse: IN1 LOW, IN2 PWM
+        appliedPwm = -pwmValue;
         digitalWrite(IN1, LOW);
         analogWrite(IN2, pwmValue);
     }
+
+    SREG = sreg;
 }
 
 void Motor::setSpeed(int percent)
@@ -70,8 +92,44 @@ void Motor::setSpeed(int percent)
     {
         return;
     }
+    int previousPercent = lastCommandPercent;
     lastCommandPercent = percent;
 
+    // Starting from standstill or reversing: break static friction first
+    bool fromRest = (previousPercent == 0) || ((previousPercent > 0) != (percent > 0));
+    if (percent == 0)
+    {
+        kickActive = false;
+    }
+    else if (fromRest && kickMs > 0 && abs(percent) < kickPercent)
+    {
+        kickActive = true;
+        kickStartMs = millis();
+    }
+
+    applyCommand();
+}
+
+void Motor::update()
+{
+    if (kickActive && (millis() - kickStartMs >= kickMs))
+    {
+        // Kick done: settle to commanded duty
+        kickActive = false;
+        applyCommand();
+    }
+}
+
+void Motor::setKickStart(uint8_t percent, uint16_t durationMs)
+{
+    kickPercent = constrain(percent, 1, 100);
+    kickMs = durationMs;
+}
+
+void Motor::applyCommand()
+{
+    int percent = lastCommandPercent;
+
     if (percent == 0)
     {
         // Stop/coast
@@ -82,21 +140,75 @@ void Motor::setSpeed(int percent)
     bool forward = (percent > 0);
     int magnitude = abs(percent);
 
+    // Hold the kick duty while the start pulse is active
+    if (kickActive && magnitude < kickPercent)
+    {
+        magnitude = kickPercent;
+    }
+
     // Map 1..100% to 1..255 duty; ensure non-zero when we say "move"
     int pwmValue = map(magnitude, 1, 100, 1, 255);
-    applyOutputs(pwmValue, forward);
+
+    // Scale by nominal/actual supply (cached Q8.8 gain)
+    uint16_t scaled = (uint16_t)(((uint32_t)pwmValue * supplyGainQ8) >> 8);
+    if (scaled > 255) scaled = 255;
+    if (scaled < 1) scaled = 1;
+
+    applyOutputs(scaled, forward);
+}
+
+void Motor::setSupplyMillivolts(uint16_t millivolts)
+{
+    // Only recompute the reciprocal when the reading actually changes
+    if (millivolts == lastSupplyMv)
+    {
+        return;
+    }
+    lastSupplyMv = millivolts;
+
+    uint16_t gain = 256;
+    if (millivolts >= MIN_SUPPLY_MV)
+    {
+        uint32_t g = ((uint32_t)NOMINAL_SUPPLY_MV << 8) / millivolts;
+        gain = (g > MAX_SUPPLY_GAIN_Q8) ? MAX_SUPPLY_GAIN_Q8 : (uint16_t)g;
+    }
+
+    if (gain == supplyGainQ8)
+    {
+        return;
+    }
+    supplyGainQ8 = gain;
+
+    // Re-apply running command with the new gain
+    if (lastCommandPercent != 0)
+    {
+        applyCommand();
+    }
 }
 
 void Motor::stop()
 {
     lastCommandPercent = 0;
+    kickActive = false;
     applyOutputs(0, true);
 }
 
+void Motor::emergencyStop()
+{
+    outputsLatchedOff = true;
+
+    // Timer1 compare outputs off, so the port bits drive D9/D10
+    TCCR1A &= ~(_BV(COM1A1) | _BV(COM1A0) | _BV(COM1B1) | _BV(COM1B0));
+    *portOutputRegister(digitalPinToPort(IN1)) &= ~digitalPinToBitMask(IN1);
+    *portOutputRegister(digitalPinToPort(IN2)) &= ~digitalPinToBitMask(IN2);
+}
+
 void Motor::brake()
 {
     // With EN tied high, both inputs LOW make both outputs LOW -> braking.
     lastCommandPercent = 0;
+    kickActive = false;
+    appliedPwm = 0;
     digitalWrite(IN1, LOW);
     digitalWrite(IN2, LOW);
 }
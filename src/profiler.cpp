@@ -0,0 +1,110 @@
+/**
+ * @file profiler.cpp
+ * @brief Per-stage execution profiler (PROFILE_ENABLED=1 only)
+ * @version 1.0.0
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "profiler.h"
+
+#if PROFILE_ENABLED
+
+ProfileStats Profiler::stages[PROF_STAGE_COUNT];
+ProfileStats Profiler::dumped;
+
+static const char STAGE_NAME_0[] PROGMEM = "readCM  ";
+static const char STAGE_NAME_1[] PROGMEM = "control ";
+static const char STAGE_NAME_2[] PROGMEM = "setSpeed";
+static const char STAGE_NAME_3[] PROGMEM = "led     ";
+static const char STAGE_NAME_4[] PROGMEM = "display ";
+
+static const char* const STAGE_NAMES[PROF_STAGE_COUNT] PROGMEM = {
+    STAGE_NAME_0, STAGE_NAME_1, STAGE_NAME_2, STAGE_NAME_3, STAGE_NAME_4
+};
+
+void Profiler::record(uint8_t stage, uint16_t startUs)
+{
+    uint16_t us = (uint16_t)micros() - startUs;
+    ProfileStats& s = stages[stage];
+
+    // Window full: everything stops together, so sumUs / runs and the
+    // histogram keep describing the same runs until the next dump
+    if (s.runs == 0xFFFF)
+        return;
+
+    if (s.runs == 0 || us < s.minUs) s.minUs = us;
+    if (us > s.maxUs) s.maxUs = us;
+    s.sumUs += us;
+    s.runs++;
+
+    // Bin = number of 4x steps above 16µs, capped at the last bin
+    uint8_t bin = 0;
+    for (uint16_t edge = 16; bin < HIST_BINS - 1 && us >= edge; edge <<= 2)
+        bin++;
+    s.bins[bin]++;      // bins add up to runs, so no overflow
+}
+
+void Profiler::reset()
+{
+    uint8_t sreg = SREG;
+    cli();
+    memset(stages, 0, sizeof(stages));
+    SREG = sreg;
+}
+
+bool Profiler::dumpLine(Print& out, uint8_t line)
+{
+    if (line == 0)
+    {
+        out.println(F("stage    runs min avg max us"));
+        return true;
+    }
+    if (line == 1)
+    {
+        out.println(F("stage    <16 <64 <256 <1k <4k >=4k"));
+        return true;
+    }
+
+    // Two lines per stage: timing, then histogram of the same copy
+    uint8_t i = (line - 2) / 2;
+    if (i >= PROF_STAGE_COUNT)
+        return false;
+
+    const __FlashStringHelper* name =
+        (const __FlashStringHelper*)pgm_read_ptr(&STAGE_NAMES[i]);
+
+    if ((line & 1) == 0)
+    {
+        // ISR-recorded stages may change mid-copy
+        uint8_t sreg = SREG;
+        cli();
+        dumped = stages[i];
+        memset(&stages[i], 0, sizeof(stages[i]));
+        SREG = sreg;
+
+        out.print(name);
+        out.print(' ');
+        out.print(dumped.runs);
+        out.print(' ');
+        out.print(dumped.minUs);
+        out.print(' ');
+        out.print(dumped.runs ? (uint16_t)(dumped.sumUs / dumped.runs) : 0);
+        out.print(' ');
+        out.println(dumped.maxUs);
+        return true;
+    }
+
+    out.print(name);
+    for (uint8_t b = 0; b < HIST_BINS; b++)
+    {
+        out.print(' ');
+        out.print(dumped.bins[b]);
+    }
+    out.println();
+    return true;
+}
+
+#endif // PROFILE_ENABLED
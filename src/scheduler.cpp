@@ -0,0 +1,179 @@
+/**
+ * @file scheduler.cpp
+ * @brief Cooperative static task table scheduler
+ * @version 1.0.0
+ *
+ * Release times are millis()-based (tick-exact is not needed at 10ms
+ * periods), execution times use micros(). Comparisons are done on the
+ * signed difference so millis() wrap-around is harmless.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "scheduler.h"
+
+#if SCHED_IDLE_SLEEP
+#include <avr/sleep.h>
+#endif
+
+Scheduler::Scheduler(SchedTask* table, uint8_t entries)
+    : tasks(table), count(entries)
+{
+}
+
+void Scheduler::begin()
+{
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        tasks[i].stats.releaseMs = now + tasks[i].phaseMs;
+        tasks[i].stats.misses = 0;
+        tasks[i].stats.lateRuns = 0;
+        clearWindow(i);
+    }
+
+#if SCHED_IDLE_SLEEP
+    windowStartMs = now;
+    sleptUs = 0;
+#endif
+}
+
+void Scheduler::clearWindow(uint8_t index)
+{
+    SchedStats& t = tasks[index].stats;
+    t.minUs = 0xFFFF;
+    t.maxUs = 0;
+    t.sumUs = 0;
+    t.runs = 0;
+}
+
+void Scheduler::dispatch()
+{
+    unsigned long now = millis();
+
+#if SCHED_IDLE_SLEEP
+    // Close the load window: slept µs / (window ms * 1000) * 100
+    unsigned long windowMs = now - windowStartMs;
+    if (windowMs >= LOAD_WINDOW_MS)
+    {
+        unsigned long asleepPct = sleptUs / (windowMs * 10);
+        loadPct = (asleepPct >= 100) ? 0 : (uint8_t)(100 - asleepPct);
+        windowStartMs = now;
+        sleptUs = 0;
+    }
+#endif
+
+    // Most urgent due periodic task; ties go to the earliest release
+    SchedTask* next = nullptr;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        SchedTask& t = tasks[i];
+        if (t.periodMs == 0 || (long)(now - t.stats.releaseMs) < 0)
+            continue;
+
+        if (next == nullptr || t.priority < next->priority ||
+            (t.priority == next->priority &&
+             (long)(t.stats.releaseMs - next->stats.releaseMs) < 0))
+        {
+            next = &t;
+        }
+    }
+
+    if (next != nullptr)
+    {
+        SchedStats& st = next->stats;
+        unsigned long release = st.releaseMs;
+        execute(*next, now);
+
+        // Deadline = next release; finishing past it is a miss
+        unsigned long after = millis();
+        if (after - release >= next->periodMs)
+        {
+            if (st.misses != 0xFFFF) st.misses++;
+            if (st.lateRuns != 0xFF) st.lateRuns++;
+        }
+        else
+        {
+            st.lateRuns = 0;
+        }
+
+        st.releaseMs = release + next->periodMs;
+
+        // More than a period behind: drop lost releases, keep the phase
+        if ((long)(after - st.releaseMs) >= (long)next->periodMs)
+        {
+            unsigned long late = after - st.releaseMs;
+            st.releaseMs += (late / next->periodMs) * next->periodMs;
+        }
+        return;
+    }
+
+    // Idle: background tasks take the slack
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (tasks[i].periodMs == 0)
+            execute(tasks[i], now);
+    }
+
+#if SCHED_IDLE_SLEEP
+    // Sleep until the next interrupt unless something came due meanwhile
+    idleSleep();
+#endif
+}
+
+#if SCHED_IDLE_SLEEP
+
+bool Scheduler::anyDue(unsigned long now) const
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (tasks[i].periodMs != 0 && (long)(now - tasks[i].stats.releaseMs) >= 0)
+            return true;
+    }
+    return false;
+}
+
+void Scheduler::idleSleep()
+{
+    unsigned long startUs = micros();
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    cli();
+    // Checked with interrupts off: a tick that lands after this check
+    // stays pending and wakes the SLEEP below (the instruction after SEI
+    // always runs), so a release is never slept through
+    if (anyDue(millis()))
+    {
+        sei();
+        return;
+    }
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+
+    sleptUs += micros() - startUs;
+}
+
+#endif // SCHED_IDLE_SLEEP
+
+void Scheduler::execute(SchedTask& t, unsigned long now)
+{
+    unsigned long startUs = micros();
+    t.run(now);
+    unsigned long us = micros() - startUs;
+
+    SchedStats& st = t.stats;
+    st.lastUs = (us > 0xFFFF) ? 0xFFFF : (uint16_t)us;
+    if (st.lastUs < st.minUs) st.minUs = st.lastUs;
+    if (st.lastUs > st.maxUs) st.maxUs = st.lastUs;
+
+    // Sum and count stop together so sumUs / runs stays a true average
+    if (st.runs != 0xFFFF)
+    {
+        st.sumUs += st.lastUs;
+        st.runs++;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file supply.cpp
+ * @brief Implementation of motor supply voltage monitor
+ * @version 1.0.0
+ * 
+ * Register-level ADC use (ATmega328P):
+ *  - REFS0 = AVcc reference, MUX = ADC_CHANNEL
+ *  - Prescaler 128 → 125kHz ADC clock, ~104µs per conversion
+ *  - ADSC is set to start, and is cleared by hardware on completion
+ * 
+ * update() is polled from the main loop; it never waits on the ADC.
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "supply.h"
+
+void SupplyMonitor::begin()
+{
+    // AVcc reference, right-adjusted result, supply channel
+    ADMUX = _BV(REFS0) | (ADC_CHANNEL & 0x0F);
+
+    // Disable digital input buffer on the analog pin
+    DIDR0 |= _BV(ADC_CHANNEL);
+
+    // Enable ADC, prescaler 128
+    ADCSRA = _BV(ADEN) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);
+
+    startConversion();
+}
+
+void SupplyMonitor::startConversion()
+{
+    ADCSRA |= _BV(ADSC);
+}
+
+void SupplyMonitor::update()
+{
+    // Conversion still running: nothing to do this tick
+    if (ADCSRA & _BV(ADSC))
+        return;
+
+    uint16_t raw = ADC;
+    startConversion();
+
+    // Pin voltage → battery voltage through divider (integer math)
+    uint32_t mv = (uint32_t)raw * VREF_MV * (R_TOP_KOHM + R_BOTTOM_KOHM)
+                  / (1023UL * R_BOTTOM_KOHM);
+    uint32_t sampleQ4 = mv << 4;
+
+    if (!primed)
+    {
+        filteredMvQ4 = sampleQ4;
+        primed = true;
+    }
+    else
+    {
+        int32_t diff = (int32_t)sampleQ4 - (int32_t)filteredMvQ4;
+        filteredMvQ4 = (uint32_t)((int32_t)filteredMvQ4 + (diff >> FILTER_SHIFT));
+    }
+
+    // Quantize to reporting resolution (round to nearest step)
+    uint16_t filtered = (uint16_t)(filteredMvQ4 >> 4);
+    supplyMv = ((filtered + SUPPLY_STEP_MV / 2) / SUPPLY_STEP_MV) * SUPPLY_STEP_MV;
+}
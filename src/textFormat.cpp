@@ -0,0 +1,70 @@
+/**
+ * @file textFormat.cpp
+ * @brief Implementation of allocation-free integer formatting
+ * @version 1.0.0
+ * 
+ * Digits are produced least-significant first into a 5-byte scratch and
+ * copied out in order; each digit is one 16-bit divide-by-10 (quotient
+ * and remainder come from the same libgcc divmod call).
+ * 
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "textFormat.h"
+
+static char* formatDigits(char* dst, uint16_t value, uint8_t width, char pad, bool negative)
+{
+    char digits[5];     // 65535 = 5 digits
+    uint8_t n = 0;
+
+    do
+    {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    uint8_t used = n + (negative ? 1 : 0);
+
+    // Zero padding goes after the sign, space padding before it
+    if (negative && pad == '0')
+        *dst++ = '-';
+
+    while (width > used)
+    {
+        *dst++ = pad;
+        width--;
+    }
+
+    if (negative && pad != '0')
+        *dst++ = '-';
+
+    while (n > 0)
+    {
+        *dst++ = digits[--n];
+    }
+
+    *dst = '\0';
+    return dst;
+}
+
+char* formatUInt(char* dst, uint16_t value, uint8_t width, char pad)
+{
+    return formatDigits(dst, value, width, pad, false);
+}
+
+char* formatInt(char* dst, int value, uint8_t width, char pad)
+{
+    if (value < 0)
+    {
+        return formatDigits(dst, (uint16_t)(-(int32_t)value), width, pad, true);
+    }
+    return formatDigits(dst, (uint16_t)value, width, pad, false);
+}
+
+char* appendP(char* dst, const char* progmemStr)
+{
+    strcpy_P(dst, progmemStr);
+    return dst + strlen(dst);
+}
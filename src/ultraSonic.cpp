@@ -46,6 +46,14 @@
  *        e) sensor out of angular field
  *  - Downstream logic interprets 0 as “no obstruction / no threat”
  *
+ * Interrupt echo capture (EVENT_PIPELINE=1):
+ *  - PCINT on ECHO (D6 = PCINT22); only that pin is enabled in PCMSK2.
+ *    The vector is fixed to PCINT2_vect, so ECHO must stay on D0-D7
+ *    (checked at compile time)
+ *  - Rising edge: micros() timestamp; falling edge: post the width
+ *  - Conversion and counters stay in the loop (toCM()), so the ISR does
+ *    no division and touches no shared statistics
+ *
  * Non-blocking design goals:
  *  - No delay() anywhere
  *  - No locking behavior
@@ -63,6 +71,15 @@
 
 #include "ultraSonic.h"
 
+// Histogram bin upper limits (cm); the last bin takes everything above
+static const uint16_t HIST_LIMIT_CM[UltraSonic::HIST_BINS - 1] = { 20, 60, 150 };
+
+void UltraSonic::count(uint16_t& counter)
+{
+    if (counter != 0xFFFF)
+        counter++;
+}
+
 void UltraSonic::begin()
 {
     pinMode(trigPin, OUTPUT);
@@ -89,24 +106,125 @@ int UltraSonic::readCM()
 
     // --- Measure echo width with timeout ---
     unsigned long duration = pulseIn(echoPin, HIGH, ECHO_TIMEOUT_US);
+    return toCM(duration);
+}
+
+int UltraSonic::toCM(unsigned long echoUs)
+{
+    count(health.readings);
 
     // Timeout or no echo
-    if (duration == 0)
+    if (echoUs == 0 || echoUs > ECHO_TIMEOUT_US)
     {
+        count(health.timeouts);
         lastDistance = 0;
         return 0;
     }
 
     // Convert to centimeters using integer math
-    int dist = static_cast<int>(duration / 58UL);
+    int dist = static_cast<int>(echoUs / 58UL);
 
     // Range filter
     if (dist < 2 || dist > 400)
     {
+        count(health.outOfRange);
         lastDistance = 0;
         return 0;
     }
 
+    uint8_t bin = 0;
+    while (bin < HIST_BINS - 1 && dist >= HIST_LIMIT_CM[bin])
+        bin++;
+    count(health.bins[bin]);
+
     lastDistance = dist;
     return dist;
 }
+
+#if EVENT_PIPELINE
+
+#include <avr/interrupt.h>
+
+namespace
+{
+    enum EchoState : uint8_t { ECHO_IDLE, ECHO_WAIT_RISE, ECHO_WAIT_FALL };
+
+    EventRing* echoEvents = nullptr;
+    volatile uint8_t* echoInput = nullptr;  ///< PINx of the echo pin
+    uint8_t echoMask = 0;
+
+    volatile uint8_t echoState = ECHO_IDLE;
+    unsigned long echoRiseUs = 0;           ///< ISR only
+}
+
+void UltraSonic::begin(EventRing& queue)
+{
+    // The vector below is PCINT2_vect: on the Uno that is port D, D0-D7.
+    // The mask bits follow echoPin, the vector does not.
+    static_assert(echoPin <= 7, "echoPin must be on port D (PCINT2) for ISR(PCINT2_vect)");
+
+    begin();
+
+    echoEvents = &queue;
+    echoInput = portInputRegister(digitalPinToPort(echoPin));
+    echoMask = digitalPinToBitMask(echoPin);
+
+    // Pin-change interrupt on ECHO only
+    uint8_t sreg = SREG;
+    cli();
+    *digitalPinToPCMSK(echoPin) |= _BV(digitalPinToPCMSKbit(echoPin));
+    PCIFR = _BV(digitalPinToPCICRbit(echoPin));
+    *digitalPinToPCICR(echoPin) |= _BV(digitalPinToPCICRbit(echoPin));
+    SREG = sreg;
+}
+
+bool UltraSonic::ping()
+{
+    unsigned long now = millis();
+    if (now - lastReadMs < MIN_INTERVAL_MS)
+        return false;
+    lastReadMs = now;
+
+    // Previous echo never completed (no echo, sensor missing / wiring).
+    // Check and re-arm together so a falling edge cannot slip between.
+    // Arm before the burst: the echo can rise ~250µs after TRIG
+    uint8_t sreg = SREG;
+    cli();
+    bool lost = (echoState != ECHO_IDLE);
+    echoState = ECHO_WAIT_RISE;
+    SREG = sreg;
+
+    digitalWrite(trigPin, LOW);
+    delayMicroseconds(2);
+    digitalWrite(trigPin, HIGH);
+    delayMicroseconds(10);
+    digitalWrite(trigPin, LOW);
+
+    return lost;
+}
+
+void UltraSonic::echoIsr()
+{
+    unsigned long t = micros();
+    bool high = (*echoInput & echoMask) != 0;
+
+    if (high && echoState == ECHO_WAIT_RISE)
+    {
+        echoRiseUs = t;
+        echoState = ECHO_WAIT_FALL;
+    }
+    else if (!high && echoState == ECHO_WAIT_FALL)
+    {
+        unsigned long width = t - echoRiseUs;
+        Event e = { EVENT_RANGE, (uint16_t)(width > 0xFFFF ? 0xFFFF : width) };
+        echoEvents->push(e);
+        echoState = ECHO_IDLE;
+    }
+}
+
+ISR(PCINT2_vect)
+{
+    UltraSonic::echoIsr();
+}
+
+#endif // EVENT_PIPELINE
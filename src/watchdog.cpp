@@ -0,0 +1,106 @@
+/**
+ * @file watchdog.cpp
+ * @brief Hardware watchdog, deadline monitor and reset reason capture
+ * @version 1.0.0
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include "watchdog.h"
+#include <avr/wdt.h>
+#include <avr/interrupt.h>
+
+/// @brief Watchdog period
+#define WATCHDOG_TIMEOUT WDTO_250MS
+
+// Written in .init3, so it must survive the .bss clear in .init4
+static uint8_t bootFlags __attribute__((section(".noinit")));
+
+static void (*timeoutHandler)() = nullptr;
+static volatile bool timedOut = false;      ///< WDT_vect ran: stop petting
+
+static const char RESET_WDT[] PROGMEM = "WDT";
+static const char RESET_BOR[] PROGMEM = "BOR";
+static const char RESET_EXT[] PROGMEM = "EXT";
+static const char RESET_UNKNOWN[] PROGMEM = "UNK";
+
+/// @brief MCUSR bits that can describe a reset
+#define RESET_BITS (_BV(WDRF) | _BV(BORF) | _BV(EXTRF) | _BV(PORF))
+
+/// @brief bootFlags value when the reset cause could not be read
+#define RESET_FLAGS_UNKNOWN 0x80
+
+void captureResetFlags() __attribute__((naked, used, section(".init3")));
+void captureResetFlags()
+{
+    uint8_t flags = MCUSR;
+#if defined(__AVR__)
+    // MCUSR already cleared by a bootloader. Optiboot v6+ hands the
+    // value over in r2; older ones leave r2 as whatever they last used,
+    // so only trust it when it looks like real reset flags.
+    if (flags == 0)
+    {
+        uint8_t r2;
+        asm volatile("mov %0, r2" : "=r"(r2));
+        flags = (r2 != 0 && (r2 & ~RESET_BITS) == 0) ? r2 : RESET_FLAGS_UNKNOWN;
+    }
+#endif
+    bootFlags = (flags == RESET_FLAGS_UNKNOWN) ? flags : (flags & RESET_BITS);
+
+    // WDRF must be cleared before the watchdog can be turned off
+    MCUSR = 0;
+    wdt_disable();
+}
+
+void Watchdog::begin(void (*onTimeout)())
+{
+    timeoutHandler = onTimeout;
+    wdt_enable(WATCHDOG_TIMEOUT);
+
+    // Interrupt + reset: the first timeout enters WDT_vect (hardware
+    // clears WDIE), the next one resets. WDIE needs no timed sequence.
+    WDTCSR |= _BV(WDIE);
+}
+
+bool Watchdog::check(uint8_t lateRuns)
+{
+    if (safeStop)
+        return false;
+
+    // A watchdog interrupt already stopped the motor: latch here too, or
+    // a recovered control task would pet away the reset and leave the
+    // motor dead with no error shown
+    if (lateRuns >= MAX_LATE_RUNS || timedOut)
+    {
+        // No more petting: the watchdog resets the board
+        safeStop = true;
+        return true;
+    }
+
+    if (lateRuns == 0)
+        wdt_reset();
+    return false;
+}
+
+uint8_t Watchdog::resetFlags()
+{
+    return bootFlags;
+}
+
+const char* Watchdog::resetReason()
+{
+    if (bootFlags == RESET_FLAGS_UNKNOWN) return RESET_UNKNOWN;
+    if (bootFlags & _BV(WDRF))  return RESET_WDT;
+    if (bootFlags & _BV(BORF))  return RESET_BOR;
+    if (bootFlags & _BV(EXTRF)) return RESET_EXT;
+    return nullptr;
+}
+
+ISR(WDT_vect)
+{
+    timedOut = true;
+    if (timeoutHandler)
+        timeoutHandler();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file test_led_sequencer.cpp
+ * @brief Host tests for LedSequencer::render()
+ * @version 1.0.0
+ *
+ * Run with: pio test -e native
+ *
+ * Tables live in ordinary memory here (PROGMEM only exists on AVR).
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include <unity.h>
+#include "ledSequencer.h"
+
+static const uint8_t BASE = 200;    ///< Base channel value under the layers
+
+static const LedKeyframe BLINK_FRAMES[] = {
+    { 10, 20, 30, LED_EASE_STEP, 100 },
+    { 40, 50, 60, LED_EASE_STEP, 100 },
+};
+
+static const LedKeyframe HOLD_FRAMES[] = {
+    { 0, 0, 255,   LED_EASE_STEP, 100 },
+    { 255, 0, 0,   LED_EASE_STEP, 0 },      // latched
+    { 0, 255, 0,   LED_EASE_STEP, 100 },    // never reached
+};
+
+static const LedKeyframe RAMP_FRAMES[] = {
+    { 0, 0, 0,     LED_EASE_LINEAR, 100 },
+    { 200, 100, 0, LED_EASE_STEP, 100 },
+};
+
+static const LedSequence BLINK_LOOP = { BLINK_FRAMES, 2, LED_BLEND_REPLACE, true };
+static const LedSequence BLINK_ONCE = { BLINK_FRAMES, 2, LED_BLEND_REPLACE, false };
+static const LedSequence HOLD_SEQ = { HOLD_FRAMES, 3, LED_BLEND_REPLACE, false };
+static const LedSequence HOLD_FIRST_SEQ = { HOLD_FRAMES + 1, 2, LED_BLEND_REPLACE, true };
+static const LedSequence RAMP_SEQ = { RAMP_FRAMES, 2, LED_BLEND_REPLACE, false };
+static const LedSequence DIM_SEQ = { BLINK_FRAMES, 1, LED_BLEND_SCALE, true };
+
+struct Rgb { uint8_t r, g, b; };
+
+static Rgb render(LedSequencer& seq, unsigned long now)
+{
+    Rgb c = { BASE, BASE, BASE };
+    seq.render(c.r, c.g, c.b, now);
+    return c;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_idle_passes_base_through()
+{
+    LedSequencer seq;
+    Rgb c = render(seq, 0);
+    TEST_ASSERT_EQUAL_UINT8(BASE, c.r);
+    TEST_ASSERT_EQUAL_UINT8(BASE, c.b);
+}
+
+void test_step_keyframes_loop()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_FAULT, &BLINK_LOOP, 1000);
+
+    TEST_ASSERT_EQUAL_UINT8(10, render(seq, 1000).r);
+    TEST_ASSERT_EQUAL_UINT8(10, render(seq, 1099).r);
+    TEST_ASSERT_EQUAL_UINT8(40, render(seq, 1100).r);
+    TEST_ASSERT_EQUAL_UINT8(10, render(seq, 1200).r);   // wrapped
+    TEST_ASSERT_EQUAL_UINT8(40, render(seq, 1750).r);   // late tick catches up
+    TEST_ASSERT_TRUE(seq.isPlaying(LedSequencer::LAYER_FAULT));
+}
+
+void test_one_shot_stops_after_last_keyframe()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_TRANSITION, &BLINK_ONCE, 0);
+
+    TEST_ASSERT_EQUAL_UINT8(40, render(seq, 150).r);
+    TEST_ASSERT_EQUAL_UINT8(BASE, render(seq, 200).r);
+    TEST_ASSERT_FALSE(seq.isPlaying(LedSequencer::LAYER_TRANSITION));
+}
+
+void test_zero_length_keyframe_holds()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_FAULT, &HOLD_SEQ, 0);
+
+    TEST_ASSERT_EQUAL_UINT8(255, render(seq, 50).b);
+
+    // Reached after 100ms, then held on every later render
+    for (unsigned long t = 100; t < 100000UL; t += 997)
+    {
+        Rgb c = render(seq, t);
+        TEST_ASSERT_EQUAL_UINT8(255, c.r);
+        TEST_ASSERT_EQUAL_UINT8(0, c.g);
+    }
+    TEST_ASSERT_TRUE(seq.isPlaying(LedSequencer::LAYER_FAULT));
+
+    // Even when the first render comes long after the hold began
+    LedSequencer late;
+    late.play(LedSequencer::LAYER_FAULT, &HOLD_SEQ, 0);
+    TEST_ASSERT_EQUAL_UINT8(255, render(late, 5000).r);
+
+    // stop() releases the hold
+    seq.stop(LedSequencer::LAYER_FAULT);
+    TEST_ASSERT_EQUAL_UINT8(BASE, render(seq, 200000UL).r);
+}
+
+void test_zero_length_first_keyframe_holds()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_FAULT, &HOLD_FIRST_SEQ, 0);
+    TEST_ASSERT_EQUAL_UINT8(255, render(seq, 0).r);
+    TEST_ASSERT_EQUAL_UINT8(255, render(seq, 60000UL).r);
+}
+
+void test_linear_interpolates_to_next()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_TRANSITION, &RAMP_SEQ, 0);
+
+    Rgb c = render(seq, 50);
+    TEST_ASSERT_TRUE(c.r >= 99 && c.r <= 100);
+    TEST_ASSERT_TRUE(c.g >= 49 && c.g <= 50);
+    TEST_ASSERT_EQUAL_UINT8(200, render(seq, 100).r);
+}
+
+void test_scale_blend()
+{
+    LedSequencer seq;
+    seq.play(LedSequencer::LAYER_TRANSITION, &DIM_SEQ, 0);
+
+    Rgb c = render(seq, 0);
+    TEST_ASSERT_EQUAL_UINT8(BASE * 10 / 255, c.r);
+    TEST_ASSERT_EQUAL_UINT8(BASE * 30 / 255, c.b);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_passes_base_through);
+    RUN_TEST(test_step_keyframes_loop);
+    RUN_TEST(test_one_shot_stops_after_last_keyframe);
+    RUN_TEST(test_zero_length_keyframe_holds);
+    RUN_TEST(test_zero_length_first_keyframe_holds);
+    RUN_TEST(test_linear_interpolates_to_next);
+    RUN_TEST(test_scale_blend);
+    return UNITY_END();
+}
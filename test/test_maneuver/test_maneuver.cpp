@@ -0,0 +1,290 @@
+/**
+ * @file test_maneuver.cpp
+ * @brief Host tests for the maneuver transition table and engine
+ * @version 1.0.0
+ *
+ * Run with: pio test -e native
+ *
+ * Covers every MANEUVER_TABLE row, the timeout boundaries, millis()
+ * wrap-around, the distance mapping, and a long pseudo-random run
+ * against a reference model of the maneuver.
+ *
+ * @author Michael Garcia, M&E Design
+ * @copyright Copyright (c) 2025 Michael Garcia, M&E Design
+ * @license MIT License
+ */
+
+#include <unity.h>
+#include "maneuver.h"
+
+static const int NEAR_CM = 30;      ///< In range, inside the mapping band
+static const int FAR_CM = 100;      ///< Out of range (>= MAX_DIST_CM)
+
+static ManeuverEngine makeEngine()
+{
+    return ManeuverEngine(MANEUVER_TABLE, MANEUVER_TABLE_ROWS);
+}
+
+/// @brief Drive a fresh engine into a state; returns the state entry time
+static uint32_t enter(ManeuverEngine& e, ManeuverState state, uint32_t t0)
+{
+    uint32_t t = t0;
+    if (state == MANEUVER_NORMAL)
+        return t;
+
+    e.step(FAR_CM, t);                          // → STOPPING
+    if (state == MANEUVER_STOPPING)
+        return t;
+
+    t += 500;
+    e.step(FAR_CM, t);                          // → REVERSING
+    if (state == MANEUVER_REVERSING)
+        return t;
+
+    t += 200;
+    e.step(FAR_CM, t);                          // → SLOW_FORWARD
+    return t;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// -----------------------------------------------------------------------------
+// Table rows
+// -----------------------------------------------------------------------------
+
+void test_table_shape()
+{
+    // A new row needs a test below
+    TEST_ASSERT_EQUAL_UINT8(10, MANEUVER_TABLE_ROWS);
+}
+
+void test_normal_out_of_range_stops()
+{
+    ManeuverEngine e = makeEngine();
+    TEST_ASSERT_EQUAL_INT(0, e.step(FAR_CM, 0));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_STOPPING, e.state());
+
+    // Boundary: exactly MAX_DIST_CM is out of range
+    ManeuverEngine b = makeEngine();
+    b.step(ManeuverEngine::MAX_DIST_CM, 0);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_STOPPING, b.state());
+}
+
+void test_normal_in_range_maps()
+{
+    ManeuverEngine e = makeEngine();
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::mapDistance(NEAR_CM), e.step(NEAR_CM, 0));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, e.state());
+
+    TEST_ASSERT_EQUAL_INT(98, e.step(ManeuverEngine::MAX_DIST_CM - 1, 10));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, e.state());
+}
+
+void test_stopping_in_range_returns_to_normal()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_STOPPING, 0);
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::mapDistance(NEAR_CM), e.step(NEAR_CM, t + 100));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, e.state());
+}
+
+void test_stopping_holds_then_times_out()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_STOPPING, 0);
+
+    TEST_ASSERT_EQUAL_INT(0, e.step(FAR_CM, t + 499));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_STOPPING, e.state());
+
+    TEST_ASSERT_EQUAL_INT(0, e.step(FAR_CM, t + 500));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_REVERSING, e.state());
+}
+
+void test_reversing_in_range_returns_to_normal()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_REVERSING, 0);
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::mapDistance(NEAR_CM), e.step(NEAR_CM, t + 50));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, e.state());
+}
+
+void test_reversing_holds_then_times_out()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_REVERSING, 0);
+
+    TEST_ASSERT_EQUAL_INT(-ManeuverEngine::REVERSE_PCT, e.step(FAR_CM, t + 199));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_REVERSING, e.state());
+
+    TEST_ASSERT_EQUAL_INT(-ManeuverEngine::REVERSE_PCT, e.step(FAR_CM, t + 200));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_SLOW_FORWARD, e.state());
+}
+
+void test_slow_forward_creeps_while_out_of_range()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_SLOW_FORWARD, 0);
+
+    // No timeout row: creeps indefinitely
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::CREEP_PCT, e.step(FAR_CM, t + 10));
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::CREEP_PCT, e.step(FAR_CM, t + 100000UL));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_SLOW_FORWARD, e.state());
+}
+
+void test_slow_forward_exits_on_in_range_reading()
+{
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_SLOW_FORWARD, 0);
+
+    TEST_ASSERT_EQUAL_INT(ManeuverEngine::mapDistance(NEAR_CM), e.step(NEAR_CM, t + 10));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, e.state());
+
+    // 0 = free path is in range too
+    ManeuverEngine f = makeEngine();
+    t = enter(f, MANEUVER_SLOW_FORWARD, 0);
+    TEST_ASSERT_EQUAL_INT(100, f.step(0, t + 10));
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_NORMAL, f.state());
+}
+
+// -----------------------------------------------------------------------------
+// Timing
+// -----------------------------------------------------------------------------
+
+void test_timeouts_across_millis_wrap()
+{
+    // Enter STOPPING 256ms before the 32-bit wrap
+    ManeuverEngine e = makeEngine();
+    uint32_t t = enter(e, MANEUVER_STOPPING, 0xFFFFFF00UL);
+
+    e.step(FAR_CM, t + 499);                    // wraps past 0
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_STOPPING, e.state());
+    e.step(FAR_CM, t + 500);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_REVERSING, e.state());
+
+    uint32_t r = t + 500;
+    e.step(FAR_CM, r + 199);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_REVERSING, e.state());
+    e.step(FAR_CM, r + 200);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_SLOW_FORWARD, e.state());
+}
+
+void test_timer_restarts_on_reentry()
+{
+    ManeuverEngine e = makeEngine();
+    enter(e, MANEUVER_STOPPING, 0);
+    e.step(NEAR_CM, 400);                       // back to NORMAL
+    e.step(FAR_CM, 450);                        // STOPPING again at 450
+
+    e.step(FAR_CM, 949);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_STOPPING, e.state());
+    e.step(FAR_CM, 950);
+    TEST_ASSERT_EQUAL_UINT8(MANEUVER_REVERSING, e.state());
+}
+
+// -----------------------------------------------------------------------------
+// Mapping
+// -----------------------------------------------------------------------------
+
+void test_map_distance()
+{
+    TEST_ASSERT_EQUAL_INT(100, ManeuverEngine::mapDistance(0));
+    for (int d = 1; d <= ManeuverEngine::MIN_DIST_CM; d++)
+        TEST_ASSERT_EQUAL_INT(0, ManeuverEngine::mapDistance(d));
+
+    int last = 0;
+    for (int d = ManeuverEngine::MIN_DIST_CM + 1; d < ManeuverEngine::MAX_DIST_CM; d++)
+    {
+        int pct = ManeuverEngine::mapDistance(d);
+        TEST_ASSERT_EQUAL_INT(0, pct % 2);      // 2% quantization
+        TEST_ASSERT_TRUE(pct >= last);          // monotonic
+        TEST_ASSERT_TRUE(pct <= 100);
+        last = pct;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Reference model (the maneuver as specified), long random run
+// -----------------------------------------------------------------------------
+
+struct Reference
+{
+    ManeuverState state = MANEUVER_NORMAL;
+    uint32_t enteredMs = 0;
+
+    void go(ManeuverState next, uint32_t now)
+    {
+        if (next != state)
+            enteredMs = now;
+        state = next;
+    }
+
+    int step(int d, uint32_t now)
+    {
+        uint32_t elapsed = now - enteredMs;
+        if (d < ManeuverEngine::MAX_DIST_CM)
+        {
+            go(MANEUVER_NORMAL, now);
+            return ManeuverEngine::mapDistance(d);
+        }
+        switch (state)
+        {
+            case MANEUVER_NORMAL:
+                go(MANEUVER_STOPPING, now);
+                return 0;
+            case MANEUVER_STOPPING:
+                if (elapsed >= 500) go(MANEUVER_REVERSING, now);
+                return 0;
+            case MANEUVER_REVERSING:
+                if (elapsed >= 200) go(MANEUVER_SLOW_FORWARD, now);
+                return -ManeuverEngine::REVERSE_PCT;
+            default:
+                return ManeuverEngine::CREEP_PCT;
+        }
+    }
+};
+
+void test_matches_reference_model()
+{
+    uint32_t seed = 12345;
+    for (uint16_t run = 0; run < 200; run++)
+    {
+        ManeuverEngine e = makeEngine();
+        Reference ref;
+        uint32_t now = (run & 1) ? 0xFFFFF000UL : 0;
+        ref.enteredMs = now;
+        e.step(0, now);                          // same start for both
+        ref.step(0, now);
+
+        for (uint16_t i = 0; i < 1000; i++)
+        {
+            seed = seed * 1103515245UL + 12345UL;
+            uint16_t r = (uint16_t)(seed >> 16);
+            int d = (r & 3) ? 60 + (r >> 4) % 300 : (r >> 4) % 60;
+            now += (r >> 8) % 15;
+
+            int expect = ref.step(d, now);
+            TEST_ASSERT_EQUAL_INT(expect, e.step(d, now));
+            TEST_ASSERT_EQUAL_UINT8(ref.state, e.state());
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_table_shape);
+    RUN_TEST(test_normal_out_of_range_stops);
+    RUN_TEST(test_normal_in_range_maps);
+    RUN_TEST(test_stopping_in_range_returns_to_normal);
+    RUN_TEST(test_stopping_holds_then_times_out);
+    RUN_TEST(test_reversing_in_range_returns_to_normal);
+    RUN_TEST(test_reversing_holds_then_times_out);
+    RUN_TEST(test_slow_forward_creeps_while_out_of_range);
+    RUN_TEST(test_slow_forward_exits_on_in_range_reading);
+    RUN_TEST(test_timeouts_across_millis_wrap);
+    RUN_TEST(test_timer_restarts_on_reentry);
+    RUN_TEST(test_map_distance);
+    RUN_TEST(test_matches_reference_model);
+    return UNITY_END();
+}